@@ -1,15 +1,29 @@
 # -*- mode: python ; coding: utf-8 -*-
+# Build the payload first: python3 installer_payload.py pack payload.gpk lib include docs examples
+# Precompile the UI pages: python3 gooey_ui.py pages/installer.json
+# For a matching native build: python3 gooey_select.py main.py --config <build>/user_config.h
+import os
+import sys
+
+sys.path.insert(0, SPECPATH)
+from gooey_select import unused_modules
+
+datas = [('roboto.ttf', '.'), ('pages/installer.json', 'pages'), ('pages/installer_style.json', 'pages')]
+if os.path.exists('payload.gpk'):
+    datas.append(('payload.gpk', '.'))
+if os.path.exists('pages/installer.json.bin'):
+    datas.append(('pages/installer.json.bin', 'pages'))
 
 a = Analysis(
     ['main.py'],
     pathex=['.'],
     binaries=[],
-    datas=[('roboto.ttf', '.')], 
+    datas=datas,
     hiddenimports=[],
     hookspath=[],
     hooksconfig={},
     runtime_hooks=[],
-    excludes=[],
+    excludes=unused_modules('main.py') + ['tkinter'],
     noarchive=False,
     optimize=0,
 )
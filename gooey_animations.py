@@ -0,0 +1,204 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+from libgooey import *
+from gooey_timers import GooeyTimerWheel_Schedule, GooeyTimerWheel_Cancel, GOOEY_TIMER_TICK_MS
+from gooey_widget import GooeyWidget_Address, GooeyWidget_GetGeometry, GooeyWidget_MoveTo, GooeyWidget_Resize
+from gooey_window import GooeyWindow_ScheduleRedraw
+import ctypes
+import time
+
+# GooeyAnimation_TranslateX
+c_lib.GooeyAnimation_TranslateX.argtypes = [ctypes.c_void_p, ctypes.c_int, ctypes.c_int, ctypes.c_float]
+c_lib.GooeyAnimation_TranslateX.restype = None
+
+def GooeyAnimation_TranslateX(widget, x_start: int, x_end: int, speed: float):
+    """
+    Native horizontal translation. Each call consumes one native timer;
+    prefer GooeyAnimation_Tween when running many animations at once.
+    """
+    c_lib.GooeyAnimation_TranslateX(widget, x_start, x_end, speed)
+
+# GooeyAnimation_TranslateY
+c_lib.GooeyAnimation_TranslateY.argtypes = [ctypes.c_void_p, ctypes.c_int, ctypes.c_int, ctypes.c_float]
+c_lib.GooeyAnimation_TranslateY.restype = None
+
+def GooeyAnimation_TranslateY(widget, y_start: int, y_end: int, speed: float):
+    """
+    Native vertical translation. Each call consumes one native timer;
+    prefer GooeyAnimation_Tween when running many animations at once.
+    """
+    c_lib.GooeyAnimation_TranslateY(widget, y_start, y_end, speed)
+
+
+# --- Easing curves ---
+
+def GOOEY_EASE_LINEAR(t): return t
+def GOOEY_EASE_IN_QUAD(t): return t * t
+def GOOEY_EASE_OUT_QUAD(t): return t * (2 - t)
+def GOOEY_EASE_IN_OUT_QUAD(t): return 2 * t * t if t < 0.5 else -1 + (4 - 2 * t) * t
+def GOOEY_EASE_OUT_CUBIC(t): return 1 - (1 - t) ** 3
+def GOOEY_EASE_IN_OUT_CUBIC(t): return 4 * t ** 3 if t < 0.5 else 1 - (-2 * t + 2) ** 3 / 2
+
+
+# --- Animation scheduler ---
+#
+# All tweens are stepped together from a single frame timer on the shared
+# timer wheel. Geometry changes are folded per widget so a widget animated
+# on several properties is moved/resized once per frame, and the window is
+# asked for one redraw per frame instead of one per animation.
+
+_GEOMETRY = ("x", "y", "width", "height")
+
+def _lerp_color(a, b, t):
+    out = 0
+    for shift in (16, 8, 0):
+        ca = (a >> shift) & 0xFF
+        cb = (b >> shift) & 0xFF
+        out |= int(round(ca + (cb - ca) * t)) << shift
+    return out
+
+
+class GooeyTween:
+    """
+    A single property animation. Created by GooeyAnimation_Tween.
+    """
+    __slots__ = ("widget", "prop", "start", "end", "duration", "easing",
+                 "setter", "on_done", "window", "started", "finished")
+
+    def __init__(self, widget, prop, start, end, duration, easing, setter, on_done, window):
+        self.widget = widget
+        self.prop = prop
+        self.start = start
+        self.end = end
+        self.duration = max(1, duration) / 1000.0
+        self.easing = easing
+        self.setter = setter
+        self.on_done = on_done
+        self.window = window
+        self.started = None
+        self.finished = False
+
+    def value_at(self, now):
+        if self.started is None:
+            self.started = now
+        t = min(1.0, (now - self.started) / self.duration)
+        if t >= 1.0:
+            self.finished = True
+        k = self.easing(t)
+        if self.prop == "color":
+            return _lerp_color(self.start, self.end, k)
+        if self.prop in _GEOMETRY:
+            return int(round(self.start + (self.end - self.start) * k))
+        return self.start + (self.end - self.start) * k
+
+
+class GooeyAnimator:
+    """
+    Steps every active tween once per frame tick.
+    """
+    def __init__(self):
+        self._tweens = []
+        self._frame = None
+        self.window = None
+
+    def add(self, tween: GooeyTween):
+        for i, other in enumerate(self._tweens):
+            if GooeyWidget_Address(other.widget) == GooeyWidget_Address(tween.widget) and other.prop == tween.prop:
+                self._tweens[i] = tween
+                break
+        else:
+            self._tweens.append(tween)
+        if self._frame is None:
+            self._frame = GooeyTimerWheel_Schedule(GOOEY_TIMER_TICK_MS, self._step, None, GOOEY_TIMER_TICK_MS)
+
+    def cancel(self, tween: GooeyTween):
+        if tween in self._tweens:
+            self._tweens.remove(tween)
+        if not self._tweens and self._frame is not None:
+            GooeyTimerWheel_Cancel(self._frame)
+            self._frame = None
+
+    def active(self) -> int:
+        return len(self._tweens)
+
+    def _step(self, user_data):
+        now = time.monotonic()
+        geometry = {}
+        windows = set()
+        for tween in list(self._tweens):
+            value = tween.value_at(now)
+            if tween.prop in _GEOMETRY:
+                key = GooeyWidget_Address(tween.widget)
+                if key not in geometry:
+                    geometry[key] = [tween.widget, list(GooeyWidget_GetGeometry(tween.widget))]
+                geometry[key][1][_GEOMETRY.index(tween.prop)] = value
+            elif tween.setter is not None:
+                tween.setter(tween.widget, value)
+            window = tween.window or self.window
+            if window:
+                windows.add(window)
+        for widget, (x, y, w, h) in geometry.values():
+            cx, cy, cw, ch = GooeyWidget_GetGeometry(widget)
+            if (x, y) != (cx, cy):
+                GooeyWidget_MoveTo(widget, x, y)
+            if (w, h) != (cw, ch):
+                GooeyWidget_Resize(widget, w, h)
+        for window in windows:
+            GooeyWindow_ScheduleRedraw(window)
+        for tween in [t for t in self._tweens if t.finished]:
+            self.cancel(tween)
+            if tween.on_done:
+                tween.on_done(tween)
+
+
+_animator = GooeyAnimator()
+
+def GooeyAnimation_SetWindow(window):
+    """
+    Sets the window that is marked damaged on every animation frame.
+    """
+    _animator.window = window
+
+def GooeyAnimation_Tween(widget, prop: str, start, end, duration_ms: int,
+                         easing=GOOEY_EASE_OUT_CUBIC, setter=None, on_done=None, window=None) -> GooeyTween:
+    """
+    Animates a widget property from start to end over duration_ms.
+
+    prop is one of "x", "y", "width", "height" (applied with GooeyWidget_MoveTo/Resize).
+    Any other property needs setter(widget, value), called every frame;
+    "color" values are 0xRRGGBB and interpolated per channel, e.g.
+    GooeyAnimation_Tween(label, "color", 0x78909C, 0x4CAF50, 300, setter=GooeyLabel_SetColor).
+    A new tween on the same widget property replaces the running one.
+    """
+    if prop not in _GEOMETRY and setter is None:
+        raise ValueError(f"Property '{prop}' needs a setter")
+    tween = GooeyTween(widget, prop, start, end, duration_ms, easing, setter, on_done, window)
+    _animator.add(tween)
+    return tween
+
+def GooeyAnimation_Cancel(tween: GooeyTween):
+    """
+    Stops a running tween, leaving the property at its current value.
+    """
+    _animator.cancel(tween)
+
+def GooeyAnimation_ActiveCount() -> int:
+    """
+    Returns the number of tweens currently running.
+    """
+    return _animator.active()
@@ -0,0 +1,90 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+from gooey_container import GooeyContainer_AddWidgets
+from gooey_widget import GooeyWidget_Address
+from gooey_timers import GooeyTimerWheel_Schedule
+import threading
+
+# --- Batched widget updates ---
+#
+# Property setters (GooeyLabel_SetColor, GooeyButton_SetEnabled, ...) are
+# collected into a GooeyBatch instead of being called immediately. Only the
+# last value per widget and setter survives, and the survivors are applied
+# in one pass, either explicitly or once on the next frame tick. Text setters
+# additionally skip values the widget already shows (see gooey_text); other
+# setters are always called, since a widget may have been changed outside
+# the batch. Updates may be queued from any
+# thread; they are applied on the thread that calls apply(), normally the UI
+# thread through apply_next_frame().
+
+
+class GooeyBatch:
+    """
+    Vector of pending widget property updates.
+    """
+    def __init__(self):
+        self._pending = {}
+        self._scheduled = False
+        self._lock = threading.Lock()
+
+    def set(self, setter, widget, *args):
+        """
+        Queues setter(widget, *args), replacing an earlier queued call of the same setter on widget.
+        """
+        key = (setter, GooeyWidget_Address(widget))
+        with self._lock:
+            self._pending[key] = (widget, args)
+
+    def apply(self, _=None) -> int:
+        """
+        Runs the queued updates; returns how many ran.
+        """
+        with self._lock:
+            pending, self._pending = self._pending, {}
+            self._scheduled = False
+        ran = 0
+        for key, (widget, args) in pending.items():
+            key[0](widget, *args)
+            ran += 1
+        return ran
+
+    def apply_next_frame(self):
+        """
+        Applies the queued updates on the next frame tick.
+        """
+        with self._lock:
+            if self._scheduled:
+                return
+            self._scheduled = True
+        GooeyTimerWheel_Schedule(0, self.apply)
+
+
+def GooeyBatch_CreateWidgets(window, container, container_id: int, descriptors):
+    """
+    Creates widgets from (create, args, [(setter, args), ...]) descriptors,
+    applies their setters and adds them all to a container page.
+    Returns the created widgets in descriptor order.
+    """
+    widgets = []
+    for create, args, setters in descriptors:
+        widget = create(*args)
+        for setter, setter_args in setters:
+            setter(widget, *setter_args)
+        widgets.append(widget)
+    GooeyContainer_AddWidgets(window, container, container_id, widgets)
+    return widgets
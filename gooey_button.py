@@ -16,6 +16,7 @@ along with this program. If not, see <https://www.gnu.org/licenses/>.
 """
 
 from libgooey import *
+from gooey_text import GooeyText_Encode, GooeyText_Remember, GooeyText_Changed
 
 class GooeyButton(ctypes.Structure):
     pass
@@ -40,7 +41,9 @@ def GooeyButton_Create(label: str, x: int, y: int, width: int, height: int,
     """
     Create a new Gooey button.
     """
-    return c_lib.GooeyButton_Create(label.encode('utf-8'), x, y, width, height, callback)
+    button = c_lib.GooeyButton_Create(GooeyText_Encode(label), x, y, width, height, callback)
+    GooeyText_Remember(button, label)
+    return button
 
 
 # GooeyButton_SetText
@@ -49,9 +52,10 @@ c_lib.GooeyButton_SetText.restype = None
 
 def GooeyButton_SetText(button: GooeyButtonPtr, text: str):
     """
-    Set the text label of a Gooey button.
+    Set the text label of a Gooey button. Does nothing if the text is unchanged.
     """
-    c_lib.GooeyButton_SetText(button, text.encode('utf-8'))
+    if GooeyText_Changed(button, text):
+        c_lib.GooeyButton_SetText(button, GooeyText_Encode(text))
 
 
 # GooeyButton_SetHighlight
@@ -16,6 +16,7 @@
 """
 
 from libgooey import *
+from gooey_text import GooeyText_Encode
 
 class GooeyCheckbox(ctypes.Structure): pass
 
@@ -31,6 +32,4 @@ def GooeyCheckbox_Create(x: int, y: int, label: str, callback: GooeyCheckboxCall
     The callback is called when the checkbox is clicked, receiving a boolean indicating
     whether the checkbox is checked (True) or unchecked (False).
     """
-    label_bytes = label.encode('utf-8')
-    
-    return c_lib.GooeyCheckbox_Create(x, y, label_bytes, callback)
+    return c_lib.GooeyCheckbox_Create(x, y, GooeyText_Encode(label), callback)
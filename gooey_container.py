@@ -58,3 +58,12 @@ def GooeyContainer_SetActiveContainer(Container, Container_id: int):
     Sets the active Container in the GooeyContainer widget.
     """
     c_lib.GooeyContainer_SetActiveContainer(Container, Container_id)
+
+def GooeyContainer_AddWidgets(Window, Container, Container_id: int, widgets):
+    """
+    Adds several widgets to a specific Container in the GooeyContainer widget.
+    Convenience loop; each widget is still added with its own native call.
+    """
+    add = c_lib.GooeyContainer_AddWidget
+    for widget in widgets:
+        add(Window, Container, Container_id, widget)
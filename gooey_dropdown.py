@@ -21,6 +21,9 @@ class GooeyDropdown(ctypes.Structure): pass
 
 GooeyDropdownCallback = ctypes.CFUNCTYPE(None, ctypes.c_int)
 
+# The C side keeps the options pointer, so the arrays must outlive the call.
+_options_arrays = {}
+
 # GooeyDropdown_Create
 c_lib.GooeyDropdown_Create.argtypes = [ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.POINTER(ctypes.POINTER(ctypes.c_char)), ctypes.c_int, GooeyDropdownCallback]
 c_lib.GooeyDropdown_Create.restype = ctypes.POINTER(GooeyDropdown)
@@ -37,7 +40,9 @@ def GooeyDropdown_Create(x: int, y: int, width: int, height: int, options: list,
         c_options_array[i] = ctypes.c_char_p(option.encode('utf-8'))
     
     c_options = ctypes.cast(c_options_array, ctypes.POINTER(ctypes.POINTER(ctypes.c_char)))
-    return c_lib.GooeyDropdown_Create(x, y, width, height, c_options, len(options), callback)
+    dropdown = c_lib.GooeyDropdown_Create(x, y, width, height, c_options, len(options), callback)
+    _options_arrays[ctypes.cast(dropdown, ctypes.c_void_p).value] = c_options_array
+    return dropdown
 
 # GooeyDropdown_Update
 c_lib.GooeyDropdown_Update.argtypes = [ctypes.POINTER(GooeyDropdown), ctypes.POINTER(ctypes.POINTER(ctypes.c_char)), ctypes.c_int]
@@ -54,3 +59,4 @@ def GooeyDropdown_Update(dropdown: ctypes.POINTER(GooeyDropdown), new_options: l
     
     c_options = ctypes.cast(c_options_array, ctypes.POINTER(ctypes.POINTER(ctypes.c_char)))
     c_lib.GooeyDropdown_Update(dropdown, c_options, num_options)
+    _options_arrays[ctypes.cast(dropdown, ctypes.c_void_p).value] = c_options_array
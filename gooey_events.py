@@ -0,0 +1,141 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+from gooey_timers import GooeyTimerWheel_Schedule
+from gooey_window import GooeyWindow_HasPendingRedraw
+from gooey_latency import GooeyLatency_Stamp, GooeyLatency_Dispatched
+from gooey_logger import GooeyLog_Error
+from gooey_trace import GooeyTrace_Begin, GooeyTrace_End, GooeyTrace_Name, GOOEY_TRACE_EVENT
+import sys
+import threading
+import traceback
+
+# --- Batched event pipeline ---
+#
+# Native widget callbacks (slider drags, list scrolls, textbox edits, canvas
+# motion) fire once per input event. Handlers wrapped here only enqueue; the
+# queue is drained once per frame tick. Consecutive events from the same
+# coalescing handler collapse into the latest one, while discrete events
+# (clicks, key presses) are kept one by one and in their original order.
+
+GOOEY_EVENT_QUEUE_CAPACITY = 1024
+
+
+class GooeyEventQueue:
+    """
+    Fixed-capacity ring buffer of pending (handler, args, coalesce, stamp) events.
+    """
+    def __init__(self, capacity: int = GOOEY_EVENT_QUEUE_CAPACITY):
+        self._ring = [None] * capacity
+        self._capacity = capacity
+        self._head = 0
+        self._count = 0
+        self._lock = threading.Lock()
+        self._frame = None
+        self.coalesced = 0
+
+    def __len__(self):
+        return self._count
+
+    def push(self, handler, args, coalesce: bool):
+        """
+        Queues an event. Returns False if the queue was full and the caller
+        should dispatch synchronously instead.
+        """
+        with self._lock:
+            if coalesce and self._count:
+                tail = (self._head + self._count - 1) % self._capacity
+                last = self._ring[tail]
+                if last[0] is handler and last[2]:
+                    # Keep the first stamp so latency covers the whole run.
+                    self._ring[tail] = (handler, args, True, last[3])
+                    self.coalesced += 1
+                    return True
+            if self._count == self._capacity:
+                return False
+            self._ring[(self._head + self._count) % self._capacity] = (handler, args, coalesce, GooeyLatency_Stamp())
+            self._count += 1
+            if self._frame is None:
+                self._frame = GooeyTimerWheel_Schedule(0, self._dispatch)
+            return True
+
+    def drain(self):
+        """
+        Removes and returns all pending events in order.
+        """
+        with self._lock:
+            batch = []
+            for _ in range(self._count):
+                batch.append(self._ring[self._head])
+                self._ring[self._head] = None
+                self._head = (self._head + 1) % self._capacity
+            self._count = 0
+            self._frame = None
+            return batch
+
+    def _dispatch(self, user_data):
+        for handler, args, _, stamp in self.drain():
+            span = GooeyTrace_Begin(GOOEY_TRACE_EVENT, handler)
+            try:
+                handler(*args)
+            except Exception:
+                # The batch is already drained; one failing handler must not lose the rest.
+                error = traceback.format_exc()
+                GooeyLog_Error("event handler %s raised:\n%s", GooeyTrace_Name(handler), error)
+                sys.stderr.write(error)
+            finally:
+                GooeyTrace_End(span)
+            GooeyLatency_Dispatched(stamp, GooeyWindow_HasPendingRedraw())
+
+
+_queue = GooeyEventQueue()
+
+def _wrap(handler, coalesce):
+    def enqueue(*args):
+        if not _queue.push(handler, args, coalesce):
+            _queue._dispatch(None)
+            stamp = GooeyLatency_Stamp()
+            handler(*args)
+            GooeyLatency_Dispatched(stamp, GooeyWindow_HasPendingRedraw())
+    enqueue.__name__ = handler.__name__
+    enqueue.__doc__ = handler.__doc__
+    return enqueue
+
+def GooeyEvent_Coalesced(handler):
+    """
+    Decorator for high-frequency callbacks (motion, drag, scroll, text edits).
+    Only the latest of a run of consecutive events reaches the handler, once per frame.
+    Apply it below the ctypes callback decorator:
+
+        @GooeySliderCallback
+        @GooeyEvent_Coalesced
+        def on_drag(value): ...
+    """
+    return _wrap(handler, True)
+
+def GooeyEvent_Queued(handler):
+    """
+    Decorator for discrete callbacks (clicks, key presses) that should be
+    dispatched in the same per-frame batch as coalesced events, in order.
+    """
+    return _wrap(handler, False)
+
+def GooeyEvent_Flush():
+    """
+    Dispatches every pending event immediately.
+    """
+    _queue._dispatch(None)
@@ -0,0 +1,257 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+from gooey_timers import GooeyTimerWheel_Schedule
+from gooey_list import GooeyList_ClearItems, GooeyList_AddItems
+from gooey_dropdown import GooeyDropdown_Update
+import heapq
+import itertools
+import threading
+
+# --- Type-to-filter index ---
+#
+# Items are indexed by lowercase trigrams, maintained incrementally as items
+# are added or removed. A query first intersects the posting sets of its
+# trigrams to find substring matches; fuzzy (subsequence) matches are only
+# searched when that leaves room in the result window, and then among at most
+# GOOEY_FILTER_FUZZY_SCAN items (those sharing a trigram with the query
+# first), so a typo costs a bounded scan rather than one over every item.
+# One or two character queries rank the hits among the first
+# GOOEY_FILTER_SHORT_SCAN items. Results cut short by either bound are
+# flagged as truncated.
+# When a query extends the previous one, only the previous matches are
+# rescored. Queries run on a worker thread; only the newest pending query is
+# processed and its visible window of results is pushed to the widget on the
+# next frame tick.
+
+GOOEY_FILTER_FUZZY_SCAN = 500      # items examined by one fuzzy pass
+GOOEY_FILTER_SHORT_SCAN = 10000    # items examined for a one or two character query
+
+
+def _trigrams(text):
+    return {text[i:i + 3] for i in range(len(text) - 2)}
+
+def _fuzzy_score(query, text):
+    """
+    Scores a subsequence match; higher is better, None if query is not a subsequence.
+    Consecutive runs and matches at word starts score higher.
+    """
+    score = 0
+    pos = -1
+    run = 0
+    for ch in query:
+        nxt = text.find(ch, pos + 1)
+        if nxt < 0:
+            return None
+        run = run + 1 if nxt == pos + 1 else 0
+        score += 1 + 2 * run + (3 if nxt == 0 or not text[nxt - 1].isalnum() else 0)
+        pos = nxt
+    return score - len(text) * 0.01
+
+
+class GooeyFilterIndex:
+    """
+    Incrementally maintained trigram index over item strings.
+    """
+    def __init__(self, items=()):
+        self._items = {}
+        self._postings = {}
+        self._next_id = 0
+        self.version = 0
+        self._lock = threading.Lock()
+        for item in items:
+            self.add(item)
+
+    def add(self, text: str) -> int:
+        with self._lock:
+            item_id = self._next_id
+            self._next_id += 1
+            self.version += 1
+            folded = text.lower()
+            self._items[item_id] = (text, folded)
+            for gram in _trigrams(folded):
+                self._postings.setdefault(gram, set()).add(item_id)
+            return item_id
+
+    def remove(self, item_id: int):
+        with self._lock:
+            entry = self._items.pop(item_id, None)
+            if entry is None:
+                return
+            self.version += 1
+            for gram in _trigrams(entry[1]):
+                posting = self._postings.get(gram)
+                if posting is not None:
+                    posting.discard(item_id)
+                    if not posting:
+                        del self._postings[gram]
+
+    def __len__(self):
+        return len(self._items)
+
+    def search(self, query: str, limit: int = 50, within=None):
+        """
+        Returns (ranked item ids, all matching ids, truncated). within
+        restricts the search to a previous result set. The matching set is
+        None when the fuzzy pass was skipped or cut short, since it is then
+        not a complete superset for narrower queries. truncated is True when
+        a scan bound was hit, so better matches may exist than those ranked.
+        """
+        query = query.lower()
+        with self._lock:
+            if not query:
+                ids = sorted(self._items) if within is None else sorted(within)
+                return ids[:limit], set(ids), False
+            grams = _trigrams(query)
+            truncated = False
+            if grams:
+                postings = sorted((self._postings.get(g, set()) for g in grams), key=len)
+                exact = set(postings[0]).intersection(*postings[1:])
+                if within is not None:
+                    exact &= within
+                scored = []
+                for item_id in exact:
+                    folded = self._items[item_id][1]
+                    at = folded.find(query)
+                    if at >= 0:
+                        scored.append((1000 - at - len(folded) * 0.01, item_id))
+                matched = {item_id for _, item_id in scored}
+            else:
+                # One or two characters match almost everything; keep the best
+                # `limit` hits of the first GOOEY_FILTER_SHORT_SCAN items in a
+                # bounded heap instead of sorting them all.
+                best = []
+                matched = set()
+                for n, item_id in enumerate(self._items if within is None else within):
+                    if n == GOOEY_FILTER_SHORT_SCAN:
+                        truncated = True
+                        break
+                    folded = self._items[item_id][1]
+                    at = folded.find(query)
+                    if at < 0:
+                        continue
+                    matched.add(item_id)
+                    entry = (1000 - at - len(folded) * 0.01, -item_id)
+                    if len(best) < limit:
+                        heapq.heappush(best, entry)
+                    elif entry > best[0]:
+                        heapq.heapreplace(best, entry)
+                scored = [(score, -neg) for score, neg in best]
+            complete = not truncated and len(matched) < limit
+            if complete:
+                # Fuzzy candidates: items sharing a trigram with the query
+                # (rarest trigrams first), then the rest, up to
+                # GOOEY_FILTER_FUZZY_SCAN items in all.
+                pool = self._items.keys() if within is None else within
+                if grams:
+                    pool = itertools.chain((i for posting in postings for i in posting), pool)
+                seen = set(matched)
+                scanned = 0
+                for item_id in pool:
+                    if item_id in seen or (within is not None and item_id not in within):
+                        continue
+                    if scanned == GOOEY_FILTER_FUZZY_SCAN:
+                        complete = False
+                        truncated = True
+                        break
+                    scanned += 1
+                    seen.add(item_id)
+                    score = _fuzzy_score(query, self._items[item_id][1])
+                    if score is not None:
+                        scored.append((score, item_id))
+                        matched.add(item_id)
+            scored.sort(key=lambda s: (-s[0], s[1]))
+            return [item_id for _, item_id in scored[:limit]], (matched if complete else None), truncated
+
+    def text(self, item_id: int) -> str:
+        return self._items[item_id][0]
+
+
+class GooeyFilter:
+    """
+    Runs queries against an index on a worker thread and delivers the
+    visible window of results to on_results(texts) on the UI thread.
+    Before on_results runs, truncated is set if those results came from a
+    bounded scan and better matches may exist. items, if given, are added to
+    the index on the worker thread.
+    """
+    def __init__(self, index: GooeyFilterIndex, on_results, visible: int = 50, items=()):
+        self.index = index
+        self._initial = items
+        self.on_results = on_results
+        self.visible = visible
+        self._pending = None
+        self._last_query = None
+        self._last_matches = None
+        self._last_version = None
+        self.truncated = False
+        self._wake = threading.Condition()
+        self._worker = threading.Thread(target=self._run, daemon=True)
+        self._worker.start()
+
+    def query(self, text: str):
+        """
+        Requests a new filter; an older query still waiting is dropped.
+        """
+        with self._wake:
+            self._pending = text
+            self._wake.notify()
+
+    def _run(self):
+        for item in self._initial:
+            self.index.add(item)
+        self._initial = ()
+        while True:
+            with self._wake:
+                while self._pending is None:
+                    self._wake.wait()
+                text, self._pending = self._pending, None
+            within = None
+            if (self._last_query and self._last_matches is not None and self._last_version == self.index.version
+                    and text.lower().startswith(self._last_query.lower())):
+                within = self._last_matches
+            version = self.index.version
+            ids, matches, truncated = self.index.search(text, self.visible, within)
+            self._last_query, self._last_matches, self._last_version = text, matches, version
+            texts = [self.index.text(i) for i in ids]
+            GooeyTimerWheel_Schedule(0, self._deliver, (text, texts, truncated))
+
+    def _deliver(self, result):
+        text, texts, truncated = result
+        with self._wake:
+            stale = self._pending is not None
+        if not stale:
+            self.truncated = truncated
+            self.on_results(texts)
+
+
+def GooeyFilter_BindList(list_widget, items, visible: int = 50, describe=None) -> GooeyFilter:
+    """
+    Creates a filter over items whose results replace the list contents.
+    describe(text) may return the description shown under each title.
+    """
+    def show(texts):
+        GooeyList_ClearItems(list_widget)
+        GooeyList_AddItems(list_widget, [(text, describe(text) if describe else "") for text in texts])
+    return GooeyFilter(GooeyFilterIndex(), show, visible, items)
+
+def GooeyFilter_BindDropdown(dropdown, options, visible: int = 50) -> GooeyFilter:
+    """
+    Creates a filter over options whose results replace the dropdown options.
+    """
+    return GooeyFilter(GooeyFilterIndex(),
+                       lambda texts: GooeyDropdown_Update(dropdown, texts, len(texts)), visible, options)
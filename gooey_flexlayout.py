@@ -0,0 +1,200 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+from gooey_layout import GOOEY_LAYOUT_HORIZONTAL, GOOEY_LAYOUT_VERTICAL
+from gooey_widget import GooeyWidget_GetGeometry, GooeyWidget_MoveTo, GooeyWidget_Resize
+
+# --- Flex layout ---
+#
+# GooeyLayout_Build places children once from padding/margin/rows/cols.
+# GooeyFlex nodes form a tree of nested row/column boxes with flexbox-style
+# basis/grow/shrink and min/max sizes. Layout results are cached per node:
+# a node is only recomputed when it, or something below it, was marked
+# dirty, or when the rectangle handed down by its parent changed. Widgets
+# are only moved/resized when their final rectangle actually differs.
+
+GOOEY_FLEX_START = 0
+GOOEY_FLEX_CENTER = 1
+GOOEY_FLEX_END = 2
+GOOEY_FLEX_STRETCH = 3
+
+_INF = float("inf")
+
+
+class GooeyFlexNode:
+    """
+    A flex box (direction set) or a leaf wrapping a native widget.
+    """
+    def __init__(self, widget=None, direction=GOOEY_LAYOUT_VERTICAL, width=None, height=None,
+                 grow=0.0, shrink=1.0, min_width=0, max_width=_INF, min_height=0, max_height=_INF,
+                 padding=0, gap=0, align=GOOEY_FLEX_STRETCH):
+        self.widget = widget
+        self.direction = direction
+        if widget is not None and (width is None or height is None):
+            _, _, w, h = GooeyWidget_GetGeometry(widget)
+            width = w if width is None else width
+            height = h if height is None else height
+        self.width = width or 0
+        self.height = height or 0
+        self.grow = grow
+        self.shrink = shrink
+        self.min_width = min_width
+        self.max_width = max_width
+        self.min_height = min_height
+        self.max_height = max_height
+        self.padding = padding
+        self.gap = gap
+        self.align = align
+        self.children = []
+        self.parent = None
+        self.rect = None
+        self._dirty = True
+        self._applied = None
+        self.layouts = 0
+
+    def mark_dirty(self):
+        node = self
+        while node is not None and not node._dirty:
+            node._dirty = True
+            node = node.parent
+
+    def _basis(self, horizontal):
+        if horizontal:
+            return min(max(self.width, self.min_width), self.max_width)
+        return min(max(self.height, self.min_height), self.max_height)
+
+    def _limits(self, horizontal):
+        if horizontal:
+            return self.min_width, self.max_width
+        return self.min_height, self.max_height
+
+    def layout(self, x, y, w, h):
+        rect = (x, y, w, h)
+        if not self._dirty and rect == self.rect:
+            return
+        self.rect = rect
+        self._dirty = False
+        self.layouts += 1
+        if self.widget is not None:
+            self._apply(rect)
+        if not self.children:
+            return
+        horizontal = self.direction == GOOEY_LAYOUT_HORIZONTAL
+        main = (w if horizontal else h) - 2 * self.padding - self.gap * (len(self.children) - 1)
+        cross = (h if horizontal else w) - 2 * self.padding
+        sizes = _resolve(self.children, horizontal, max(0, main))
+        pos = float((x if horizontal else y) + self.padding)
+        cross_origin = (y if horizontal else x) + self.padding
+        for child, size in zip(self.children, sizes):
+            start = int(round(pos))
+            pos += size
+            length = int(round(pos)) - start
+            pos += self.gap
+            lo, hi = child._limits(not horizontal)
+            if self.align == GOOEY_FLEX_STRETCH:
+                extent = min(max(cross, lo), hi)
+            else:
+                extent = min(child._basis(not horizontal), cross)
+            offset = 0
+            if self.align == GOOEY_FLEX_CENTER:
+                offset = (cross - extent) // 2
+            elif self.align == GOOEY_FLEX_END:
+                offset = cross - extent
+            if horizontal:
+                child.layout(start, cross_origin + offset, length, extent)
+            else:
+                child.layout(cross_origin + offset, start, extent, length)
+
+    def _apply(self, rect):
+        if rect == self._applied:
+            return
+        x, y, w, h = rect
+        if self._applied is None or self._applied[:2] != (x, y):
+            GooeyWidget_MoveTo(self.widget, x, y)
+        if self._applied is None or self._applied[2:] != (w, h):
+            GooeyWidget_Resize(self.widget, w, h)
+        self._applied = rect
+
+
+def _resolve(children, horizontal, available):
+    """
+    Distributes available main-axis space using basis, grow/shrink and min/max.
+    """
+    sizes = [c._basis(horizontal) for c in children]
+    frozen = [False] * len(children)
+    while True:
+        free = available - sum(sizes)
+        if abs(free) < 0.5:
+            break
+        growing = free > 0
+        weights = [0.0 if frozen[i] else (c.grow if growing else c.shrink * c._basis(horizontal))
+                   for i, c in enumerate(children)]
+        total = sum(weights)
+        if total <= 0:
+            break
+        clamped = False
+        for i, c in enumerate(children):
+            if not weights[i]:
+                continue
+            lo, hi = c._limits(horizontal)
+            target = sizes[i] + free * weights[i] / total
+            if target < lo or target > hi:
+                target = min(max(target, lo), hi)
+                frozen[i] = True
+                clamped = True
+            sizes[i] = target
+        if not clamped:
+            break
+    return sizes
+
+
+def GooeyFlex_Create(direction=GOOEY_LAYOUT_VERTICAL, **props) -> GooeyFlexNode:
+    """
+    Creates a flex container laying its children out in a row or column.
+    Accepts width, height, grow, shrink, min/max_width, min/max_height, padding, gap, align.
+    """
+    return GooeyFlexNode(None, direction, **props)
+
+def GooeyFlex_Widget(widget, **props) -> GooeyFlexNode:
+    """
+    Wraps a native widget as a flex item. Its current size is used as basis unless given.
+    """
+    return GooeyFlexNode(widget, **props)
+
+def GooeyFlex_AddChild(parent: GooeyFlexNode, child: GooeyFlexNode):
+    """
+    Appends a child node (a widget item or a nested container).
+    """
+    child.parent = parent
+    parent.children.append(child)
+    parent.mark_dirty()
+
+def GooeyFlex_Set(node: GooeyFlexNode, **props):
+    """
+    Updates layout properties of a node; only it and its ancestors are recomputed.
+    """
+    for key, value in props.items():
+        if not hasattr(node, key) or key in ("children", "parent", "rect", "widget"):
+            raise AttributeError(f"Unknown flex property '{key}'")
+        setattr(node, key, value)
+    node.mark_dirty()
+
+def GooeyFlex_Layout(root: GooeyFlexNode, x: int, y: int, width: int, height: int):
+    """
+    Lays out the tree into the given rectangle, reusing cached results for clean subtrees.
+    """
+    root.layout(x, y, width, height)
@@ -16,6 +16,7 @@
 """
 
 from libgooey import *
+from gooey_text import GooeyText_Encode, GooeyText_Remember, GooeyText_Changed
 import ctypes
 
 class GooeyLabel(ctypes.Structure): pass
@@ -28,8 +29,9 @@ def GooeyLabel_Create(text: str, font_size: float, x: int, y: int):
     """
     Creates a new GooeyLabel widget and attaches it to a window.
     """
-    text_bytes = text.encode('utf-8')  
-    return c_lib.GooeyLabel_Create(text_bytes, font_size, x, y)
+    label = c_lib.GooeyLabel_Create(GooeyText_Encode(text), font_size, x, y)
+    GooeyText_Remember(label, text)
+    return label
 
 # GooeyLabel_SetText
 c_lib.GooeyLabel_SetText.argtypes = [ctypes.POINTER(GooeyLabel), ctypes.c_char_p]
@@ -37,10 +39,10 @@ c_lib.GooeyLabel_SetText.restype = None
 
 def GooeyLabel_SetText(label: ctypes.POINTER(GooeyLabel), text: str):
     """
-    Updates the text of an existing label.
+    Updates the text of an existing label. Does nothing if the text is unchanged.
     """
-    text_bytes = text.encode('utf-8')  
-    c_lib.GooeyLabel_SetText(label, text_bytes)
+    if GooeyText_Changed(label, text):
+        c_lib.GooeyLabel_SetText(label, GooeyText_Encode(text))
 
 # GooeyLabel_SetColor
 c_lib.GooeyLabel_SetColor.argtypes = [ctypes.POINTER(GooeyLabel), ctypes.c_ulong]
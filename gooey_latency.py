@@ -0,0 +1,129 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+import math
+import threading
+import time
+
+# --- Input latency histograms ---
+#
+# Events entering through gooey_events are stamped when the native callback
+# hands them to Python. The stamp is closed twice: once the handler has run
+# ("dispatch") and once the redraw it caused has been requested from the
+# native loop ("present"). Events whose handler damaged nothing only count
+# towards "dispatch".
+
+GOOEY_LATENCY_SUBBUCKETS = 4   # buckets per power of two
+GOOEY_LATENCY_MAX_US = 1 << 24 # ~16.7 s, larger samples land in the last bucket
+
+_BUCKETS = GOOEY_LATENCY_SUBBUCKETS * 24 + 1
+
+
+class GooeyLatencyHistogram:
+    """
+    Log-bucketed histogram of latencies in microseconds, about 19% resolution.
+    """
+    def __init__(self):
+        self.reset()
+
+    def reset(self):
+        self._counts = [0] * _BUCKETS
+        self.count = 0
+        self.max_us = 0
+
+    def record(self, us: float):
+        us = max(1.0, min(us, GOOEY_LATENCY_MAX_US))
+        self._counts[int(math.log2(us) * GOOEY_LATENCY_SUBBUCKETS)] += 1
+        self.count += 1
+        self.max_us = max(self.max_us, us)
+
+    def percentile(self, p: float) -> float:
+        """
+        Returns the upper bound of the bucket holding the p-th percentile, in microseconds.
+        """
+        if not self.count:
+            return 0.0
+        rank = math.ceil(self.count * p / 100.0)
+        seen = 0
+        for i, n in enumerate(self._counts):
+            seen += n
+            if seen >= rank:
+                return min(2.0 ** ((i + 1) / GOOEY_LATENCY_SUBBUCKETS), self.max_us)
+        return self.max_us
+
+
+_lock = threading.Lock()
+_histograms = {"dispatch": GooeyLatencyHistogram(), "present": GooeyLatencyHistogram()}
+_awaiting_present = []
+
+def GooeyLatency_Stamp() -> float:
+    """
+    Returns a timestamp for an input event entering Python.
+    """
+    return time.perf_counter()
+
+def GooeyLatency_Dispatched(stamp: float, damaged: bool):
+    """
+    Closes the dispatch span of an event. Events that damaged a window stay
+    open until GooeyLatency_Presented is called.
+    """
+    now = time.perf_counter()
+    with _lock:
+        _histograms["dispatch"].record((now - stamp) * 1e6)
+        if damaged:
+            _awaiting_present.append(stamp)
+
+def GooeyLatency_Presented():
+    """
+    Closes the present span of every event waiting on a redraw.
+    """
+    now = time.perf_counter()
+    with _lock:
+        for stamp in _awaiting_present:
+            _histograms["present"].record((now - stamp) * 1e6)
+        _awaiting_present.clear()
+
+def GooeyLatency_Query(kind: str = "present") -> dict:
+    """
+    Returns {"count", "p50_ms", "p99_ms", "max_ms"} for "dispatch" or "present".
+    """
+    with _lock:
+        h = _histograms[kind]
+        return {
+            "count": h.count,
+            "p50_ms": h.percentile(50) / 1000.0,
+            "p99_ms": h.percentile(99) / 1000.0,
+            "max_ms": h.max_us / 1000.0
+        }
+
+def GooeyLatency_Reset():
+    """
+    Clears all recorded samples.
+    """
+    with _lock:
+        for h in _histograms.values():
+            h.reset()
+        _awaiting_present.clear()
+
+def GooeyLatency_Report() -> str:
+    """
+    One-line summary suitable for a debug label or the log.
+    """
+    d = GooeyLatency_Query("dispatch")
+    p = GooeyLatency_Query("present")
+    return (f"input->dispatch p50 {d['p50_ms']:.2f} ms p99 {d['p99_ms']:.2f} ms | "
+            f"input->redraw p50 {p['p50_ms']:.2f} ms p99 {p['p99_ms']:.2f} ms (n={p['count']})")
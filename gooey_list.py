@@ -16,6 +16,7 @@
 """
 
 from libgooey import *
+from gooey_text import GooeyText_Encode, GooeyText_Changed, GooeyText_Forget
 import ctypes
 
 #list
@@ -41,9 +42,7 @@ def GooeyList_AddItem(list_widget: ctypes.POINTER(GooeyList), title: str, descri
     """
     Adds an item to the GooeyList widget.
     """
-    title_bytes = title.encode('utf-8')
-    description_bytes = description.encode('utf-8')
-    c_lib.GooeyList_AddItem(list_widget, title_bytes, description_bytes)
+    c_lib.GooeyList_AddItem(list_widget, GooeyText_Encode(title), GooeyText_Encode(description))
 
 # GooeyList_ClearItems
 c_lib.GooeyList_ClearItems.argtypes = [ctypes.POINTER(GooeyList)]
@@ -53,6 +52,7 @@ def GooeyList_ClearItems(list_widget: ctypes.POINTER(GooeyList)):
     """
     Clears all items from the GooeyList widget.
     """
+    GooeyText_Forget(list_widget)
     c_lib.GooeyList_ClearItems(list_widget)
 
 # GooeyList_ShowSeparator
@@ -71,8 +71,18 @@ c_lib.GooeyList_UpdateItem.restype = None
 
 def GooeyList_UpdateItem(list_widget: ctypes.POINTER(GooeyList), item_index: int, title: str, description: str):
     """
-    Updates a specific item in the GooeyList widget.
+    Updates a specific item in the GooeyList widget. Does nothing if the item is unchanged.
     """
-    title_bytes = title.encode('utf-8')
-    description_bytes = description.encode('utf-8')
-    c_lib.GooeyList_UpdateItem(list_widget, item_index, title_bytes, description_bytes)
+    if GooeyText_Changed(list_widget, (title, description), item_index + 1):
+        c_lib.GooeyList_UpdateItem(list_widget, item_index, GooeyText_Encode(title), GooeyText_Encode(description))
+
+def GooeyList_AddItems(list_widget: ctypes.POINTER(GooeyList), items):
+    """
+    Adds (title, description) pairs to the GooeyList widget. This is still
+    one native call per item; it only encodes the strings up front and
+    avoids the per-call wrapper overhead.
+    """
+    encoded = [(GooeyText_Encode(title), GooeyText_Encode(description)) for title, description in items]
+    add = c_lib.GooeyList_AddItem
+    for title, description in encoded:
+        add(list_widget, title, description)
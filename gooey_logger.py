@@ -0,0 +1,237 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+from libgooey import *
+import atexit
+import ctypes
+import heapq
+import os
+import threading
+import time
+
+# DebugLevel
+DEBUG_LEVEL_INFO = 0
+DEBUG_LEVEL_WARNING = 1
+DEBUG_LEVEL_ERROR = 2
+DEBUG_LEVEL_CRITICAL = 3
+
+# set_logging_enabled
+c_lib.set_logging_enabled.argtypes = [ctypes.c_bool]
+c_lib.set_logging_enabled.restype = None
+
+def set_logging_enabled(enabled: bool):
+    """
+    Enables or disables the native library's logging.
+    """
+    c_lib.set_logging_enabled(enabled)
+
+# set_minimum_log_level
+c_lib.set_minimum_log_level.argtypes = [ctypes.c_int]
+c_lib.set_minimum_log_level.restype = None
+
+def set_minimum_log_level(level: int):
+    """
+    Drops native log messages below level.
+    """
+    c_lib.set_minimum_log_level(level)
+
+# save_log_file
+c_lib.save_log_file.argtypes = [ctypes.c_char_p]
+c_lib.save_log_file.restype = None
+
+def save_log_file(path: str):
+    """
+    Writes the native library's in-memory log to path.
+    """
+    c_lib.save_log_file(path.encode("utf-8"))
+
+
+# --- Asynchronous logger ---
+#
+# GooeyLog_Info/Warning/Error/Critical do not format or write anything on
+# the calling thread. Each thread appends (time, level, fmt, args) records
+# to its own fixed-size ring; a thread only ever advances its ring's tail and
+# the flusher only its head, so producers never take a lock. A background
+# flusher thread wakes every GOOEY_LOG_FLUSH_MS (or at once for errors),
+# merges the rings by time, formats the records and appends them to the log
+# file. A full ring drops new records and counts them, so memory use stays
+# bounded however fast a hot path logs.
+#
+# Records below the minimum level cost one comparison. The level is taken
+# from GOOEY_LOG_LEVEL (info, warning, error, critical) at import and can be
+# changed with GooeyLog_SetLevel, which also sets the native library's level.
+
+GOOEY_LOG_RING_SIZE = 4096
+GOOEY_LOG_FLUSH_MS = 200
+
+_LEVEL_NAMES = ("INFO", "WARNING", "ERROR", "CRITICAL")
+
+_env_level = os.environ.get("GOOEY_LOG_LEVEL", "info").upper()
+_min_level = _LEVEL_NAMES.index(_env_level) if _env_level in _LEVEL_NAMES else DEBUG_LEVEL_INFO
+
+
+class GooeyLogRing:
+    """
+    Single-producer, single-consumer ring of pending log records.
+    """
+    __slots__ = ("records", "head", "tail", "dropped", "owner")
+
+    def __init__(self, size: int = GOOEY_LOG_RING_SIZE):
+        self.records = [None] * size
+        self.head = 0
+        self.tail = 0
+        self.dropped = 0
+        self.owner = threading.current_thread()
+
+    def push(self, record) -> bool:
+        tail = self.tail
+        if tail - self.head == len(self.records):
+            self.dropped += 1
+            return False
+        self.records[tail % len(self.records)] = record
+        self.tail = tail + 1  # publish after the slot is written
+        return True
+
+    def take(self):
+        head, tail = self.head, self.tail
+        size = len(self.records)
+        out = [self.records[i % size] for i in range(head, tail)]
+        for i in range(head, tail):
+            self.records[i % size] = None
+        self.head = tail
+        return out
+
+
+_local = threading.local()
+_rings = []
+_rings_lock = threading.Lock()
+_flush_lock = threading.Lock()
+_wake = threading.Event()
+_flusher = None
+_file = None
+
+
+def _ring():
+    ring = getattr(_local, "ring", None)
+    if ring is None:
+        ring = _local.ring = GooeyLogRing()
+        with _rings_lock:
+            _rings.append(ring)
+    return ring
+
+
+def GooeyLog_Write(level: int, fmt: str, *args):
+    """
+    Queues a record; fmt % args is only evaluated by the flusher.
+    """
+    if level < _min_level:
+        return
+    _ring().push((time.time(), level, fmt, args))
+    if level >= DEBUG_LEVEL_ERROR:
+        _wake.set()
+
+def GooeyLog_Info(fmt: str, *args):
+    if _min_level <= DEBUG_LEVEL_INFO:
+        _ring().push((time.time(), DEBUG_LEVEL_INFO, fmt, args))
+
+def GooeyLog_Warning(fmt: str, *args):
+    if _min_level <= DEBUG_LEVEL_WARNING:
+        _ring().push((time.time(), DEBUG_LEVEL_WARNING, fmt, args))
+
+def GooeyLog_Error(fmt: str, *args):
+    GooeyLog_Write(DEBUG_LEVEL_ERROR, fmt, *args)
+
+def GooeyLog_Critical(fmt: str, *args):
+    GooeyLog_Write(DEBUG_LEVEL_CRITICAL, fmt, *args)
+
+
+def GooeyLog_SetLevel(level: int):
+    """
+    Sets the minimum level for Python and native log messages.
+    """
+    global _min_level
+    _min_level = level
+    set_minimum_log_level(level)
+
+
+def _format(record):
+    stamp, level, fmt, args = record
+    try:
+        message = fmt % args if args else fmt
+    except (TypeError, ValueError) as e:
+        message = f"{fmt!r} % {args!r} ({e})"
+    when = time.strftime("%Y-%m-%d %H:%M:%S", time.localtime(stamp))
+    return f"[{when}] [{_LEVEL_NAMES[level]}] {message}\n"
+
+
+def GooeyLog_Flush() -> int:
+    """
+    Writes every queued record now; returns how many were written.
+    """
+    with _rings_lock:
+        rings = list(_rings)
+    with _flush_lock:
+        # A ring whose thread had already exited is complete once taken.
+        finished = [ring for ring in rings if not ring.owner.is_alive()]
+        batches = [ring.take() for ring in rings]
+        lines = [_format(record) for record in heapq.merge(*batches, key=lambda r: r[0])]
+        for ring in rings:
+            if ring.dropped:
+                dropped, ring.dropped = ring.dropped, 0
+                lines.append(_format((time.time(), DEBUG_LEVEL_WARNING,
+                                      "%d log records dropped on thread %s", (dropped, ring.owner.name))))
+        if finished:
+            with _rings_lock:
+                for ring in finished:
+                    _rings.remove(ring)
+        if lines and _file is not None:
+            _file.write("".join(lines))
+            _file.flush()
+        return len(lines)
+
+
+def _flush_loop():
+    while True:
+        _wake.wait(GOOEY_LOG_FLUSH_MS / 1000.0)
+        _wake.clear()
+        try:
+            GooeyLog_Flush()
+        except OSError:
+            pass  # disk full or file gone; keep draining so rings stay bounded
+
+
+def GooeyLog_Open(path: str) -> bool:
+    """
+    Starts logging to path (appending). The file is never opened through a
+    symlink. Returns False if it cannot be opened.
+    """
+    global _file, _flusher
+    try:
+        os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+        fd = os.open(path, os.O_WRONLY | os.O_APPEND | os.O_CREAT | getattr(os, "O_NOFOLLOW", 0), 0o644)
+        log_file = os.fdopen(fd, "a", encoding="utf-8")
+    except OSError:
+        return False
+    if _file is not None:
+        GooeyLog_Flush()
+        _file.close()
+    _file = log_file
+    if _flusher is None:
+        _flusher = threading.Thread(target=_flush_loop, name="gooey-log", daemon=True)
+        _flusher.start()
+        atexit.register(GooeyLog_Flush)
+    return True
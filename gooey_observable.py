@@ -0,0 +1,89 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+from gooey_batch import GooeyBatch
+from gooey_signals import GooeySignal
+
+# --- Observable values ---
+#
+# A GooeyObservable holds one model value and a `changed` GooeySignal that
+# fires only when the value actually changes. Binding a widget connects a
+# slot that queues the widget's setter into a shared GooeyBatch applied on
+# the next frame, so a value written many times per frame reaches each bound
+# widget once, with its latest value. Text setters also skip text the widget
+# already shows, so writes that format to the same text cost no FFI call.
+#
+#   count = GooeyObservable(0, int)
+#   GooeyObservable_Bind(count, GooeyLabel_SetText, label, lambda n: f"{n} items")
+#   GooeyObservable_Bind(count, GooeyMeter_Update, meter)
+#   count.set(42)
+#
+# set() may be called from worker threads when only widgets are bound: the
+# binding slots just queue work for the UI thread.
+
+_frame_batch = GooeyBatch()
+
+
+class GooeyObservable:
+    """
+    Model value that notifies bound widgets and slots when it changes.
+    kind (int, float, str, ...) converts every value written.
+    """
+    __slots__ = ("_value", "_kind", "changed")
+
+    def __init__(self, value=None, kind=None):
+        self._kind = kind
+        self._value = kind(value) if kind is not None and value is not None else value
+        self.changed = GooeySignal()
+
+    def get(self):
+        return self._value
+
+    def set(self, value) -> bool:
+        """
+        Stores value; returns False (and notifies nobody) if it is unchanged.
+        """
+        if self._kind is not None:
+            value = self._kind(value)
+        if value == self._value:
+            return False
+        self._value = value
+        self.changed.emit(value)
+        return True
+
+    value = property(get, set)
+
+
+def GooeyObservable_Bind(observable: GooeyObservable, setter, widget, fmt=None):
+    """
+    Keeps widget in sync through setter(widget, fmt(value)) (or the raw value
+    without fmt), applied at most once per frame. The current value is
+    applied on the next frame too. Returns the slot; disconnect() it to unbind.
+    """
+    def changed(value):
+        _frame_batch.set(setter, widget, fmt(value) if fmt else value)
+        _frame_batch.apply_next_frame()
+    if observable.get() is not None:
+        changed(observable.get())
+    return observable.changed.connect(changed)
+
+
+def GooeyObservable_Flush() -> int:
+    """
+    Applies pending widget updates now instead of on the next frame.
+    """
+    return _frame_batch.apply()
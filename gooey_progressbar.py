@@ -16,6 +16,9 @@
 """
 
 from libgooey import *
+from gooey_timers import GooeyTimerWheel_Schedule, GooeyTimerWheel_Cancel, GOOEY_TIMER_TICK_MS
+from gooey_label import GooeyLabel_SetText
+import threading
 
 class GooeyProgressBar(ctypes.Structure): pass
 
@@ -38,3 +41,131 @@ def GooeyProgressBar_Update(progressbar: ctypes.POINTER(GooeyProgressBar), new_v
     Updates the value of the GooeyProgressBar widget.
     """
     c_lib.GooeyProgressBar_Update(progressbar, new_value)
+
+
+# --- Progress channel ---
+#
+# A worker thread reports progress by writing plain counters into a
+# GooeyProgressChannel; it never calls into the library or triggers a redraw.
+# A binding samples the channel once per frame from the timer wheel on the UI
+# thread, eases the bar toward the reported value, and only crosses the FFI
+# when the shown percentage, status text or phase actually changed.
+
+GOOEY_PROGRESS_EASE = 0.25   # fraction of the remaining distance covered per frame
+
+
+class GooeyProgressChannel:
+    """
+    Counters shared between a worker and a progress binding. Each phase maps
+    its done/total units onto a [start, end] percentage span of the bar.
+    Writers update under a lock and publish one immutable snapshot tuple,
+    so the UI thread reads a consistent state without locking.
+    """
+    def __init__(self):
+        self._lock = threading.Lock()
+        self._phase = -1
+        self._start = 0.0
+        self._end = 0.0
+        self._done = 0
+        self._total = 0
+        self._files_done = 0
+        self._files_total = 0
+        self._status = ""
+        self._finished = False
+        self._complete = False
+        self.snapshot = (0.0, -1, "", 0, 0, False)
+
+    def _publish(self):
+        frac = min(1.0, self._done / self._total) if self._total else 0.0
+        percent = self._start + (self._end - self._start) * frac
+        if self._finished and self._complete:
+            percent = 100.0
+        self.snapshot = (percent, self._phase, self._status, self._files_done, self._files_total, self._finished)
+
+    def begin(self, phase: int, start: float, end: float, total: int = 0, files_total: int = 0):
+        """
+        Starts a phase covering [start, end] percent with total units of work.
+        """
+        with self._lock:
+            self._phase, self._start, self._end = phase, start, end
+            self._done, self._total = 0, total
+            self._files_done, self._files_total = 0, files_total
+            self._publish()
+
+    def update(self, done: int, files_done: int = None):
+        with self._lock:
+            self._done = done
+            if files_done is not None:
+                self._files_done = files_done
+            self._publish()
+
+    def set_status(self, text: str):
+        with self._lock:
+            self._status = text
+            self._publish()
+
+    def finish(self, status: str = None, complete: bool = True):
+        """
+        Marks the work as finished. The binding fills the bar if complete,
+        otherwise leaves it where it stopped, and then stops sampling.
+        """
+        with self._lock:
+            if status is not None:
+                self._status = status
+            self._finished = True
+            self._complete = complete
+            self._publish()
+
+
+class GooeyProgressBinding:
+    """
+    Frame-rate view of a GooeyProgressChannel on a progress bar and label.
+    on_phase(phase) and on_finish() run on the UI thread.
+    """
+    def __init__(self, channel, progressbar, label=None, on_phase=None, on_finish=None):
+        self.channel = channel
+        self.progressbar = progressbar
+        self.label = label
+        self.on_phase = on_phase
+        self.on_finish = on_finish
+        self._shown = 0.0
+        self._value = None
+        self._status = None
+        self._phase = None
+        self._handle = GooeyTimerWheel_Schedule(GOOEY_TIMER_TICK_MS, self._tick, None, GOOEY_TIMER_TICK_MS)
+
+    def _tick(self, _):
+        percent, phase, status, _files, _total, finished = self.channel.snapshot
+        if phase != self._phase:
+            self._phase = phase
+            if self.on_phase:
+                self.on_phase(phase)
+        if status != self._status:
+            self._status = status
+            if self.label:
+                GooeyLabel_SetText(self.label, status)
+        self._shown += (percent - self._shown) * GOOEY_PROGRESS_EASE
+        if abs(percent - self._shown) < 0.5:
+            self._shown = percent
+        value = int(self._shown)
+        if value != self._value:
+            self._value = value
+            GooeyProgressBar_Update(self.progressbar, value)
+        if finished and self._shown == percent:
+            self.stop()
+            if self.on_finish:
+                self.on_finish()
+
+    def stop(self):
+        if self._handle is not None:
+            GooeyTimerWheel_Cancel(self._handle)
+            self._handle = None
+
+
+def GooeyProgressBar_Bind(progressbar, channel: GooeyProgressChannel, label=None,
+                          on_phase=None, on_finish=None) -> GooeyProgressBinding:
+    """
+    Drives progressbar (and optionally a status label) from channel at frame
+    rate until the channel finishes. Call from the UI thread.
+    """
+    return GooeyProgressBinding(channel, progressbar, label, on_phase, on_finish)
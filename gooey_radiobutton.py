@@ -16,6 +16,7 @@
 """
 
 from libgooey import *
+from gooey_text import GooeyText_Encode
 
 class GooeyRadioButton(ctypes.Structure): pass
 class GooeyRadioButtonGroup(ctypes.Structure): pass
@@ -30,7 +31,7 @@ def GooeyRadioButton_Create(x: int, y: int, label: str, callback):
     Adds a radio button to the window at the specified position with a label and a callback.
     The callback is invoked when the radio button is selected.
     """
-    label_bytes = label.encode('utf-8')
+    label_bytes = GooeyText_Encode(label)
     c_callback = ctypes.CFUNCTYPE(None, ctypes.c_bool)(callback)
     
     return c_lib.GooeyRadioButton_Create(x, y, label_bytes, c_callback)
@@ -53,7 +54,7 @@ def GooeyRadioButtonGroup_AddChild(win, group, x: int, y: int, label: str, callb
     """
     Adds a radio button to the specified radio button group within a window.
     """
-    label_bytes = label.encode('utf-8')
+    label_bytes = GooeyText_Encode(label)
     c_callback = ctypes.CFUNCTYPE(None, ctypes.c_bool)(callback)
     
     return c_lib.GooeyRadioButtonGroup_AddChild(win, group, x, y, label_bytes, c_callback)
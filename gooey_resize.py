@@ -0,0 +1,166 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+from gooey_timers import GooeyTimerWheel_Schedule, GooeyTimerWheel_Cancel, GOOEY_TIMER_TICK_MS
+from gooey_widget import GooeyWidget_GetGeometry, GooeyWidget_MoveTo, GooeyWidget_Resize
+from gooey_window import GooeyWindow_GetSize, GooeyWindow_ScheduleRedraw
+from gooey_flexlayout import GooeyFlex_Layout
+import time
+
+# --- Resize-driven relayout ---
+#
+# The native resize callback may fire many times per second while the user
+# drags a window edge, and it is not exposed to the bindings. The window size
+# is therefore checked on a slow idle timer (GOOEY_RESIZE_IDLE_MS); only once
+# a change is seen is it sampled every frame tick. While the size keeps
+# changing (live resize) layouts are only recomputed when the size crosses
+# into a new size class; once the size has been stable for
+# GOOEY_RESIZE_SETTLE_MS a full-quality relayout runs at the exact final size
+# and sampling drops back to the idle rate. Code that learns about a resize
+# earlier (an input handler, say) can call GooeyResize_Notify.
+
+GOOEY_ANCHOR_LEFT = 1
+GOOEY_ANCHOR_TOP = 2
+GOOEY_ANCHOR_RIGHT = 4
+GOOEY_ANCHOR_BOTTOM = 8
+GOOEY_ANCHOR_DEFAULT = GOOEY_ANCHOR_LEFT | GOOEY_ANCHOR_TOP
+GOOEY_ANCHOR_ALL = GOOEY_ANCHOR_LEFT | GOOEY_ANCHOR_TOP | GOOEY_ANCHOR_RIGHT | GOOEY_ANCHOR_BOTTOM
+
+GOOEY_RESIZE_SIZE_CLASS = 32   # px granularity of live-resize relayouts
+GOOEY_RESIZE_SETTLE_MS = 150   # no size change for this long ends a live resize
+GOOEY_RESIZE_IDLE_MS = 250     # size check interval while nothing is resizing
+
+
+def _anchor_axis(pos, size, base_extent, extent, near, far):
+    if near and far:
+        return pos, max(0, size + extent - base_extent)
+    if far:
+        return pos + extent - base_extent, size
+    if not near:
+        return pos + (extent - base_extent) // 2, size
+    return pos, size
+
+
+class GooeyResizeHandler:
+    """
+    Per-window resize state: anchored widgets, an optional flex root and
+    the live-resize tracking.
+    """
+    def __init__(self, window, root=None):
+        self.window = window
+        self.root = root
+        self.anchors = []
+        self.base_size = GooeyWindow_GetSize(window)
+        self.size = self.base_size
+        self.applied_class = None
+        self.last_change = None
+        self.live = False
+        self.relayouts = 0
+        self._frame = None
+        self._schedule(GOOEY_RESIZE_IDLE_MS)
+
+    def anchor(self, widget, anchors):
+        self.anchors.append((widget, anchors, GooeyWidget_GetGeometry(widget)))
+
+    def detach(self):
+        if self._frame is not None:
+            GooeyTimerWheel_Cancel(self._frame)
+            self._frame = None
+
+    def _schedule(self, delay_ms):
+        self.detach()
+        self._frame = GooeyTimerWheel_Schedule(delay_ms, self._poll)
+
+    def notify(self):
+        """
+        Switches to per-frame sampling right away.
+        """
+        self._schedule(GOOEY_TIMER_TICK_MS)
+
+    def _poll(self, user_data):
+        self._frame = None
+        self._sample()
+        self._schedule(GOOEY_TIMER_TICK_MS if self.live else GOOEY_RESIZE_IDLE_MS)
+
+    def _sample(self):
+        size = GooeyWindow_GetSize(self.window)
+        now = time.monotonic()
+        if size != self.size:
+            self.size = size
+            self.last_change = now
+            self.live = True
+            size_class = (size[0] // GOOEY_RESIZE_SIZE_CLASS, size[1] // GOOEY_RESIZE_SIZE_CLASS)
+            if size_class != self.applied_class:
+                self.applied_class = size_class
+                self._relayout(size_class[0] * GOOEY_RESIZE_SIZE_CLASS, size_class[1] * GOOEY_RESIZE_SIZE_CLASS)
+        elif self.live and (now - self.last_change) * 1000 >= GOOEY_RESIZE_SETTLE_MS:
+            self.live = False
+            self._relayout(*size)
+
+    def _relayout(self, width, height):
+        self.relayouts += 1
+        base_w, base_h = self.base_size
+        for widget, anchors, (x, y, w, h) in self.anchors:
+            nx, nw = _anchor_axis(x, w, base_w, width, anchors & GOOEY_ANCHOR_LEFT, anchors & GOOEY_ANCHOR_RIGHT)
+            ny, nh = _anchor_axis(y, h, base_h, height, anchors & GOOEY_ANCHOR_TOP, anchors & GOOEY_ANCHOR_BOTTOM)
+            cx, cy, cw, ch = GooeyWidget_GetGeometry(widget)
+            if (nx, ny) != (cx, cy):
+                GooeyWidget_MoveTo(widget, nx, ny)
+            if (nw, nh) != (cw, ch):
+                GooeyWidget_Resize(widget, nw, nh)
+        if self.root is not None:
+            GooeyFlex_Layout(self.root, 0, 0, width, height)
+        GooeyWindow_ScheduleRedraw(self.window)
+
+
+_handlers = {}
+
+def GooeyResize_Attach(window, root=None) -> GooeyResizeHandler:
+    """
+    Starts tracking a resizable window. root is an optional GooeyFlex tree
+    laid out to the full window size.
+    """
+    handler = _handlers.get(window)
+    if handler is None:
+        handler = GooeyResizeHandler(window, root)
+        _handlers[window] = handler
+    elif root is not None:
+        handler.root = root
+    return handler
+
+def GooeyResize_Anchor(window, widget, anchors: int = GOOEY_ANCHOR_DEFAULT):
+    """
+    Keeps a widget's distance to the anchored window edges constant.
+    Anchoring both opposite edges stretches the widget; anchoring neither keeps it centred.
+    """
+    GooeyResize_Attach(window).anchor(widget, anchors)
+
+def GooeyResize_Notify(window):
+    """
+    Tells a tracked window that its size may be changing.
+    """
+    handler = _handlers.get(window)
+    if handler is not None:
+        handler.notify()
+
+def GooeyResize_Detach(window):
+    """
+    Stops tracking a window.
+    """
+    handler = _handlers.pop(window, None)
+    if handler is not None:
+        handler.detach()
@@ -0,0 +1,186 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+import ast
+import os
+import re
+import statistics
+import subprocess
+import sys
+import time
+
+# --- Widget selection ---
+#
+# Works out which binding modules an application actually reaches by walking
+# its import graph (including imports inside functions), and derives from
+# that the widget set it needs. From the selection it can
+#   - list the binding modules to exclude from a PyInstaller build,
+#   - write a user_config.h with every unused ENABLE_* flag set to 0, for a
+#     native build specialised to the application,
+#   - compare the selected set against the full binding set in size and
+#     import time (--compare).
+#
+#   python3 gooey_select.py main.py --compare
+#   python3 gooey_select.py main.py --config build/user_config.h
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+# Binding module -> user_config.h flag it needs.
+WIDGET_FLAGS = {
+    "gooey_button": "ENABLE_BUTTON",
+    "gooey_canvas": "ENABLE_CANVAS",
+    "gooey_checkbox": "ENABLE_CHECKBOX",
+    "gooey_container": "ENABLE_CONTAINER",
+    "gooey_dropdown": "ENABLE_DROPDOWN",
+    "gooey_dropsurface": "ENABLE_DROP_SURFACE",
+    "gooey_image": "ENABLE_IMAGE",
+    "gooey_label": "ENABLE_LABEL",
+    "gooey_layout": "ENABLE_LAYOUT",
+    "gooey_list": "ENABLE_LIST",
+    "gooey_menu": "ENABLE_MENU",
+    "gooey_meter": "ENABLE_METER",
+    "gooey_plot": "ENABLE_PLOT",
+    "gooey_progressbar": "ENABLE_PROGRESSBAR",
+    "gooey_radiobutton": "ENABLE_RADIOBUTTON",
+    "gooey_slider": "ENABLE_SLIDER",
+    "gooey_tabs": "ENABLE_TABS",
+    "gooey_textbox": "ENABLE_TEXTBOX",
+}
+# Flags enabled by a symbol rather than a module.
+SYMBOL_FLAGS = {
+    "GooeyWindow_EnableDebugOverlay": "ENABLE_DEBUG_OVERLAY",
+}
+
+
+def _imports(path):
+    with open(path) as f:
+        tree = ast.parse(f.read(), path)
+    names = set()
+    symbols = set()
+    for node in ast.walk(tree):
+        if isinstance(node, ast.Import):
+            names.update(alias.name.split(".")[0] for alias in node.names)
+        elif isinstance(node, ast.ImportFrom) and node.module and node.level == 0:
+            names.add(node.module.split(".")[0])
+        elif isinstance(node, ast.Name) and isinstance(node.ctx, ast.Load):
+            symbols.add(node.id)
+    return names, symbols
+
+
+def used_modules(entry: str, root: str = HERE):
+    """
+    Returns (local modules reachable from entry, symbols they reference).
+    """
+    seen = set()
+    symbols = set()
+    stack = [os.path.splitext(os.path.basename(entry))[0]]
+    while stack:
+        name = stack.pop()
+        path = os.path.join(root, name + ".py")
+        if name in seen or not os.path.exists(path):
+            continue
+        seen.add(name)
+        names, syms = _imports(path)
+        symbols |= syms
+        stack.extend(names - seen)
+    return seen, symbols
+
+
+def binding_modules(root: str = HERE):
+    return sorted(f[:-3] for f in os.listdir(root)
+                  if f.startswith("gooey_") and f.endswith(".py") and f != "gooey_select.py")
+
+
+def unused_modules(entry: str, root: str = HERE):
+    """
+    Binding modules the application never imports, e.g. for PyInstaller's excludes.
+    """
+    used, _ = used_modules(entry, root)
+    return [m for m in binding_modules(root) if m not in used]
+
+
+def enabled_flags(entry: str, root: str = HERE):
+    used, symbols = used_modules(entry, root)
+    flags = {flag for module, flag in WIDGET_FLAGS.items() if module in used}
+    flags |= {flag for symbol, flag in SYMBOL_FLAGS.items() if symbol in symbols}
+    return flags
+
+
+def write_config(entry: str, template: str, out: str, root: str = HERE):
+    """
+    Writes template (a user_config.h) to out with unused ENABLE_* flags set to 0.
+    """
+    keep = enabled_flags(entry, root)
+    with open(template) as f:
+        text = f.read()
+    def flag(m):
+        return f"#define {m.group(1)} {1 if m.group(1) in keep else 0}"
+    text = re.sub(r"#define (ENABLE_(?!VIRTUAL_KEYBOARD)\w+) 1", flag, text)
+    os.makedirs(os.path.dirname(os.path.abspath(out)), exist_ok=True)
+    with open(out, "w") as f:
+        f.write(text)
+    return keep
+
+
+def _import_time(modules, runs=5):
+    code = "import " + ", ".join(modules) if modules else "pass"
+    times = []
+    for _ in range(runs):
+        start = time.perf_counter()
+        result = subprocess.run([sys.executable, "-c", code], cwd=HERE, capture_output=True, text=True)
+        if result.returncode != 0:
+            return None, result.stderr.strip().splitlines()[-1]
+        times.append(time.perf_counter() - start)
+    return statistics.median(times), None
+
+
+def compare(entry: str, root: str = HERE):
+    used, _ = used_modules(entry, root)
+    full = binding_modules(root)
+    selected = [m for m in full if m in used]
+    size = lambda mods: sum(os.path.getsize(os.path.join(root, m + ".py")) for m in mods)
+    flags = enabled_flags(entry, root)
+    print(f"binding modules: {len(selected)}/{len(full)}, {size(selected)} of {size(full)} bytes of source")
+    print(f"widget flags enabled: {len(flags)}/{len(set(WIDGET_FLAGS.values()) | set(SYMBOL_FLAGS.values()))}"
+          f" ({', '.join(sorted(flags))})")
+    for label, mods in (("full", full), ("selected", selected)):
+        seconds, error = _import_time(mods)
+        if error:
+            print(f"import time ({label}): unavailable, {error}")
+        else:
+            print(f"import time ({label}): {seconds * 1000:.1f} ms")
+
+
+def main(argv):
+    if not argv:
+        print("usage: gooey_select.py ENTRY.py [--compare] [--excludes] [--config OUT [--template user_config.h]]")
+        return 2
+    entry = argv[0]
+    if "--excludes" in argv:
+        print("\n".join(unused_modules(entry)))
+    if "--config" in argv:
+        out = argv[argv.index("--config") + 1]
+        template = argv[argv.index("--template") + 1] if "--template" in argv else os.path.join(HERE, "include", "user_config.h")
+        keep = write_config(entry, template, out)
+        print(f"wrote {out} with {len(keep)} widget flags enabled")
+    if "--compare" in argv:
+        compare(entry)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
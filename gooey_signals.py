@@ -0,0 +1,269 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+from libgooey import *
+from gooey_logger import GooeyLog_Error
+from gooey_timers import GooeyTimerWheel_Schedule
+import ctypes
+import sys
+import threading
+import traceback
+
+GooeySignalCallback = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_void_p)
+
+class GooeySignal_Slot(ctypes.Structure): pass
+GooeySignal_Slot._fields_ = [
+    ("callback", GooeySignalCallback),
+    ("context", ctypes.c_void_p),
+    ("next", ctypes.POINTER(GooeySignal_Slot)),
+]
+
+class GooeyNativeSignal(ctypes.Structure):
+    _fields_ = [("slots", ctypes.POINTER(GooeySignal_Slot))]
+
+# GooeySignal_Create
+c_lib.GooeySignal_Create.argtypes = []
+c_lib.GooeySignal_Create.restype = GooeyNativeSignal
+
+def GooeySignal_Create():
+    """
+    Creates a native signal with no linked callbacks.
+    """
+    return c_lib.GooeySignal_Create()
+
+# GooeySignal_Link
+c_lib.GooeySignal_Link.argtypes = [ctypes.POINTER(GooeyNativeSignal), GooeySignalCallback, ctypes.c_void_p]
+c_lib.GooeySignal_Link.restype = None
+
+def GooeySignal_Link(signal, callback: GooeySignalCallback, context=None):
+    """
+    Links a callback to a native signal. The caller keeps the callback alive.
+    """
+    c_lib.GooeySignal_Link(ctypes.byref(signal), callback, context)
+
+# GooeySignal_Emit
+c_lib.GooeySignal_Emit.argtypes = [ctypes.POINTER(GooeyNativeSignal), ctypes.c_void_p]
+c_lib.GooeySignal_Emit.restype = None
+
+def GooeySignal_Emit(signal, data=None):
+    """
+    Calls every callback linked to a native signal with data.
+    """
+    c_lib.GooeySignal_Emit(ctypes.byref(signal), data)
+
+# GooeySignal_UnLinkAll
+c_lib.GooeySignal_UnLinkAll.argtypes = [ctypes.POINTER(GooeyNativeSignal)]
+c_lib.GooeySignal_UnLinkAll.restype = None
+
+def GooeySignal_UnLinkAll(signal):
+    """
+    Unlinks and frees every callback of a native signal.
+    """
+    c_lib.GooeySignal_UnLinkAll(ctypes.byref(signal))
+
+
+# --- Python signals ---
+#
+# The native signal is a singly linked list of malloc'd slots that can only
+# be cleared as a whole. GooeySignal keeps its slots in an array instead:
+# connect() appends and returns the slot itself as the handle, which records
+# its index, so disconnect() is O(1) (the entry is tombstoned and the array
+# compacted once half of it is dead). Every connect() returns a fresh
+# handle, and disconnecting a handle twice is harmless.
+#
+# emit() walks the array length captured on entry: slots connected during
+# an emission first fire on the next one, slots disconnected during it are
+# skipped, and compaction waits until the outermost emit() returns, so
+# handlers may connect, disconnect and emit recursively.
+#
+# emit_queued() does not call anything; it appends to a GooeySignalQueue that
+# is drained once per frame on the timer wheel (or by another thread calling
+# deliver()). Signals created with coalesce=True keep only their latest
+# queued payload per drain.
+
+class GooeySignalSlot:
+    """
+    Connection handle returned by GooeySignal.connect.
+    """
+    __slots__ = ("signal", "index", "callback")
+
+    def __init__(self, signal, index, callback):
+        self.signal = signal
+        self.index = index
+        self.callback = callback
+
+    @property
+    def connected(self) -> bool:
+        return self.signal is not None
+
+    def disconnect(self):
+        if self.signal is not None:
+            self.signal.disconnect(self)
+
+
+def _release(slot):
+    slot.signal = None
+    slot.callback = None
+    slot.index = -1
+
+
+class GooeySignal:
+    """
+    Signal with O(1) connect/disconnect and re-entrancy-safe emission.
+    """
+    __slots__ = ("_slots", "_dead", "_depth", "coalesce", "__weakref__")
+
+    def __init__(self, coalesce: bool = False):
+        self._slots = []
+        self._dead = 0
+        self._depth = 0
+        self.coalesce = coalesce
+
+    def __len__(self):
+        return len(self._slots) - self._dead
+
+    def connect(self, callback) -> GooeySignalSlot:
+        """
+        Connects callback(*args); returns the slot handle used to disconnect it.
+        """
+        slot = GooeySignalSlot(self, len(self._slots), callback)
+        self._slots.append(slot)
+        return slot
+
+    def disconnect(self, slot: GooeySignalSlot):
+        """
+        Disconnects a slot; does nothing if it is already disconnected.
+        """
+        if slot.signal is not self:
+            return
+        self._slots[slot.index] = None
+        self._dead += 1
+        _release(slot)
+        if self._depth == 0 and self._dead * 2 > len(self._slots):
+            self._compact()
+
+    def disconnect_all(self):
+        for slot in self._slots:
+            if slot is not None:
+                _release(slot)
+        if self._depth:
+            self._dead = len(self._slots)
+            self._slots[:] = [None] * self._dead
+        else:
+            self._slots = []
+            self._dead = 0
+
+    def _compact(self):
+        live = [slot for slot in self._slots if slot is not None]
+        for i, slot in enumerate(live):
+            slot.index = i
+        self._slots = live
+        self._dead = 0
+
+    def emit(self, *args) -> int:
+        """
+        Calls every connected slot in connection order; returns how many ran.
+        """
+        slots = self._slots
+        count = len(slots)
+        ran = 0
+        self._depth += 1
+        try:
+            for i in range(count):
+                slot = slots[i]
+                if slot is not None:
+                    slot.callback(*args)
+                    ran += 1
+        finally:
+            self._depth -= 1
+            if self._depth == 0 and self._dead * 2 > len(self._slots):
+                self._compact()
+        return ran
+
+    def emit_queued(self, *args, queue=None):
+        """
+        Queues an emission for the next frame (or for queue's consumer thread).
+        Safe to call from any thread.
+        """
+        (_frame_queue if queue is None else queue).push(self, args)
+
+
+class GooeySignalQueue:
+    """
+    Pending (signal, args) emissions, delivered in order by deliver().
+    With schedule=True the queue delivers itself on the next wheel tick.
+    """
+    def __init__(self, schedule: bool = True):
+        self._pending = []
+        self._latest = {}
+        self._lock = threading.Lock()
+        self._ready = threading.Condition(self._lock)
+        self._schedule = schedule
+        self._frame = None
+        self.coalesced = 0
+
+    def __len__(self):
+        return len(self._pending)
+
+    def push(self, signal: GooeySignal, args):
+        with self._lock:
+            if signal.coalesce:
+                index = self._latest.get(id(signal))
+                if index is not None:
+                    self._pending[index] = (signal, args)
+                    self.coalesced += 1
+                    return
+                self._latest[id(signal)] = len(self._pending)
+            self._pending.append((signal, args))
+            if self._schedule and self._frame is None:
+                self._frame = GooeyTimerWheel_Schedule(0, self.deliver)
+            self._ready.notify()
+
+    def deliver(self, _=None) -> int:
+        """
+        Emits everything queued so far; emissions queued meanwhile wait for the next call.
+        A slot that raises is logged and ends only its own emission.
+        """
+        with self._lock:
+            pending, self._pending = self._pending, []
+            self._latest.clear()
+            self._frame = None
+        for signal, args in pending:
+            try:
+                signal.emit(*args)
+            except Exception:
+                # The queue is already swapped out; one failing slot must not lose the rest.
+                error = traceback.format_exc()
+                GooeyLog_Error("queued signal slot raised:\n%s", error)
+                sys.stderr.write(error)
+        return len(pending)
+
+    def wait(self, timeout: float = None) -> bool:
+        """
+        Blocks a consumer thread until something is queued.
+        """
+        with self._lock:
+            return self._ready.wait_for(lambda: self._pending, timeout)
+
+
+_frame_queue = GooeySignalQueue()
+
+def GooeySignal_Queue() -> GooeySignalQueue:
+    """
+    The shared queue emit_queued uses by default, delivered once per frame.
+    """
+    return _frame_queue
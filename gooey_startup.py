@@ -0,0 +1,101 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+import os
+import sys
+import time
+
+# --- Startup trace ---
+#
+# Import this module first. It records the time already spent before Python
+# reached it (interpreter start), then each GooeyStartup_Phase block, and
+# finally the time to the first frame, measured by a wheel timer that fires
+# on the first event loop iteration. Set GOOEY_STARTUP_TRACE=1 to print the
+# breakdown to stderr once the first frame is up.
+
+_t0 = time.perf_counter()
+_phases = []
+_marks = {}
+_done = False
+
+
+def _process_age():
+    """
+    Seconds since this process was started, or 0 if the platform cannot say.
+    """
+    try:
+        with open("/proc/self/stat") as f:
+            # Field 22 (starttime) follows the parenthesised command name.
+            start_ticks = int(f.read().rsplit(")", 1)[1].split()[19])
+        with open("/proc/uptime") as f:
+            uptime = float(f.read().split()[0])
+        return max(0.0, uptime - start_ticks / os.sysconf("SC_CLK_TCK"))
+    except (OSError, ValueError, IndexError):
+        return 0.0
+
+_phases.append(("interpreter start", _process_age()))
+
+
+class GooeyStartup_Phase:
+    """
+    Context manager timing one named startup phase.
+    """
+    def __init__(self, name: str):
+        self.name = name
+
+    def __enter__(self):
+        self._start = time.perf_counter()
+        return self
+
+    def __exit__(self, *exc):
+        _phases.append((self.name, time.perf_counter() - self._start))
+        return False
+
+
+def GooeyStartup_Mark(name: str):
+    """
+    Records the time since startup at which a named point was reached.
+    """
+    _marks.setdefault(name, time.perf_counter() - _t0)
+
+
+def _first_frame(_):
+    global _done
+    GooeyStartup_Mark("first frame")
+    _done = True
+    if os.environ.get("GOOEY_STARTUP_TRACE"):
+        sys.stderr.write(GooeyStartup_Report() + "\n")
+
+
+def GooeyStartup_WatchFirstFrame():
+    """
+    Call right before GooeyWindow_Run; records when the event loop first runs.
+    """
+    from gooey_timers import GooeyTimerWheel_Schedule
+    GooeyTimerWheel_Schedule(0, _first_frame)
+
+
+def GooeyStartup_Report() -> str:
+    """
+    Returns the startup breakdown as a text table.
+    """
+    lines = ["startup phase                     ms"]
+    for name, seconds in _phases:
+        lines.append(f"  {name:<28}{seconds * 1000:8.1f}")
+    for name, seconds in sorted(_marks.items(), key=lambda m: m[1]):
+        lines.append(f"@ {name:<28}{(seconds + _phases[0][1]) * 1000:8.1f}")
+    return "\n".join(lines)
@@ -0,0 +1,175 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+from gooey_batch import GooeyBatch
+from gooey_label import GooeyLabel_Create, GooeyLabel_SetColor
+from gooey_widget import GooeyWidget_Address
+import json
+
+# --- Style tokens ---
+#
+# A style sheet is JSON with two sections:
+#
+#   "tokens":  named values (colors, font sizes, radii, padding); a value of
+#              "$name" refers to another token.
+#   "widgets": per widget type defaults under "label", "button", ..., and
+#              per-variant overrides under "label.title", "label.error", ...
+#              A "*" entry applies to every widget type.
+#
+# Sheets are resolved once when they are applied: every (type, variant) pair
+# becomes a flat GooeyStyleRecord with tokens already substituted, so styling
+# a widget is a dictionary lookup plus one setter call per styled property.
+# Styled widgets are remembered by address; applying another sheet restyles
+# them in one batch. Call GooeyStyle_Forget before destroying a styled widget.
+
+GOOEY_STYLE_PROPS = ("color", "background", "font_size", "radius", "padding")
+
+
+class GooeyStyleRecord:
+    """
+    Resolved style of one widget type and variant.
+    """
+    __slots__ = GOOEY_STYLE_PROPS
+
+    def __init__(self, values):
+        for prop in GOOEY_STYLE_PROPS:
+            setattr(self, prop, values.get(prop))
+
+
+def _color_value(value):
+    if isinstance(value, str) and value.lower().startswith(("0x", "#")):
+        return int(value.lstrip("#"), 16)
+    return value
+
+
+class GooeyStyleSheet:
+    def __init__(self, tokens=None, widgets=None):
+        self.tokens = {}
+        raw = tokens or {}
+        for name in raw:
+            self.tokens[name] = self._resolve(raw, name, ())
+        self.records = {}
+        widgets = widgets or {}
+        base = self._values(widgets.get("*", {}))
+        for key, props in widgets.items():
+            if key == "*":
+                continue
+            kind, _, variant = key.partition(".")
+            values = dict(base)
+            values.update(self._values(widgets.get(kind, {})))
+            if (kind, None) not in self.records:
+                self.records[(kind, None)] = GooeyStyleRecord(values)
+            if variant:
+                values.update(self._values(props))
+                self.records[(kind, variant)] = GooeyStyleRecord(values)
+
+    def _resolve(self, raw, name, chain):
+        if name in chain:
+            raise ValueError(f"style token cycle: {' -> '.join(chain + (name,))}")
+        value = raw[name]
+        if isinstance(value, str) and value.startswith("$"):
+            return self._resolve(raw, value[1:], chain + (name,))
+        return _color_value(value)
+
+    def _values(self, props):
+        values = {}
+        for prop, value in props.items():
+            if prop not in GOOEY_STYLE_PROPS:
+                raise ValueError(f"unknown style property {prop!r}")
+            if isinstance(value, str) and value.startswith("$"):
+                value = self.tokens[value[1:]]
+            values[prop] = _color_value(value)
+        return values
+
+    def token(self, name):
+        return self.tokens[name]
+
+    def record(self, kind: str, variant: str = None) -> GooeyStyleRecord:
+        """
+        Record for a widget type and variant, falling back to the type's defaults.
+        """
+        rec = self.records.get((kind, variant))
+        if rec is None:
+            rec = self.records.get((kind, None))
+            if rec is None:
+                raise KeyError(f"no style for {kind}" + (f".{variant}" if variant else ""))
+        return rec
+
+
+def GooeyStyle_Load(path: str) -> GooeyStyleSheet:
+    """
+    Loads and resolves a style sheet file.
+    """
+    with open(path) as f:
+        doc = json.load(f)
+    return GooeyStyleSheet(doc.get("tokens"), doc.get("widgets"))
+
+
+# Widget type -> [(property, setter)] the style system can apply after creation.
+_setters = {
+    "label": [("color", GooeyLabel_SetColor)],
+}
+_styled = {}   # widget address -> (widget, kind, variant)
+_batch = GooeyBatch()
+_active = None
+
+def GooeyStyle_RegisterSetter(kind: str, prop: str, setter):
+    """
+    Lets widgets of a type receive a style property through setter(widget, value).
+    """
+    _setters.setdefault(kind, []).append((prop, setter))
+
+def _queue(widget, kind, variant):
+    rec = _active.record(kind, variant)
+    for prop, setter in _setters.get(kind, ()):
+        value = getattr(rec, prop)
+        if value is not None:
+            _batch.set(setter, widget, value)
+
+def GooeyStyle_Use(sheet: GooeyStyleSheet):
+    """
+    Makes sheet the active style sheet and restyles every styled widget.
+    """
+    global _active
+    _active = sheet
+    for widget, kind, variant in _styled.values():
+        _queue(widget, kind, variant)
+    _batch.apply()
+
+def GooeyStyle_Apply(widget, kind: str, variant: str = None):
+    """
+    Styles widget from the active sheet and keeps it styled across sheet changes.
+    """
+    _styled[GooeyWidget_Address(widget)] = (widget, kind, variant)
+    _queue(widget, kind, variant)
+    _batch.apply()
+    return widget
+
+def GooeyStyle_Forget(widget):
+    """
+    Stops restyling a widget, e.g. before it is destroyed.
+    """
+    _styled.pop(GooeyWidget_Address(widget), None)
+
+def GooeyStyle_Token(name: str):
+    return _active.token(name)
+
+def GooeyStyle_Label(text: str, x: int, y: int, variant: str = None):
+    """
+    Creates a label with the font size and color of its style variant.
+    """
+    return GooeyStyle_Apply(GooeyLabel_Create(text, _active.record("label", variant).font_size, x, y), "label", variant)
@@ -0,0 +1,80 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+from gooey_widget import GooeyWidget_Address
+
+# --- Widget text helpers ---
+#
+# Label, button, checkbox, textbox and list item text is stored in fixed
+# char[256] fields on the C side. Encoded strings are interned here so the
+# same status message is not re-encoded on every update, are cut on a UTF-8
+# character boundary instead of mid-sequence, and setters can skip the FFI
+# call entirely when a widget already shows the requested text.
+
+GOOEY_TEXT_MAX_BYTES = 255   # char[256] minus the terminator
+GOOEY_TEXT_CACHE_SIZE = 4096
+
+_encoded = {}
+_shown = {}   # widget address -> {field: text}
+
+def GooeyText_Encode(text: str) -> bytes:
+    """
+    Returns text as UTF-8, truncated to fit a widget text field without
+    splitting a multi-byte character. Results are interned.
+    """
+    data = _encoded.get(text)
+    if data is not None:
+        return data
+    data = text.encode('utf-8')
+    if len(data) > GOOEY_TEXT_MAX_BYTES:
+        data = data[:GOOEY_TEXT_MAX_BYTES]
+        # Drop a trailing partial sequence: back up over continuation bytes.
+        end = len(data)
+        while end > 0 and (data[end - 1] & 0xC0) == 0x80:
+            end -= 1
+        if end > 0 and data[end - 1] >= 0xC0:
+            lead = data[end - 1]
+            need = 2 if lead < 0xE0 else 3 if lead < 0xF0 else 4
+            if len(data) - (end - 1) < need:
+                data = data[:end - 1]
+    if len(_encoded) >= GOOEY_TEXT_CACHE_SIZE:
+        _encoded.clear()
+    _encoded[text] = data
+    return data
+
+def GooeyText_Remember(widget, text: str, field=0):
+    """
+    Records the text a widget currently shows.
+    """
+    _shown.setdefault(GooeyWidget_Address(widget), {})[field] = text
+
+def GooeyText_Changed(widget, text: str, field=0) -> bool:
+    """
+    Returns True and records text if it differs from what the widget shows.
+    Only use for fields the user cannot edit directly.
+    """
+    fields = _shown.setdefault(GooeyWidget_Address(widget), {})
+    if fields.get(field) == text:
+        return False
+    fields[field] = text
+    return True
+
+def GooeyText_Forget(widget):
+    """
+    Drops cached text for a widget, e.g. after its items were cleared.
+    """
+    _shown.pop(GooeyWidget_Address(widget), None)
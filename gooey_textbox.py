@@ -16,6 +16,7 @@
 """
 
 from libgooey import *
+from gooey_text import GooeyText_Encode
 
 class GooeyWindow(ctypes.Structure): pass
 class GooeyTextbox(ctypes.Structure):   pass
@@ -30,7 +31,7 @@ def GooeyTextBox_Create(x: int, y: int, width: int, height: int, placeholder: st
     """
     Creates a new GooeyTextbox widget at the specified position and dimensions with optional placeholder text.
     """
-    c_placeholder = placeholder.encode('utf-8')
+    c_placeholder = GooeyText_Encode(placeholder)
     return c_lib.GooeyTextBox_Create(x, y, width, height, c_placeholder, is_password, callback)
 
 # GooeyTextbox_Draw
@@ -81,5 +82,5 @@ def GooeyTextbox_SetText(textbox, text: str):
     """
     Sets the text of the textbox.
     """
-    c_text = text.encode('utf-8')
+    c_text = GooeyText_Encode(text)
     c_lib.GooeyTextbox_setText(textbox, c_text)
@@ -0,0 +1,297 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+from gooey_label import GooeyLabel_SetText
+from bisect import bisect_right
+from collections import OrderedDict
+import mmap
+import os
+
+# --- Piece table text model ---
+#
+# GooeyTextbox keeps a single line in char[256]. GooeyPieceTable holds large
+# multi-line documents: the original file is memory-mapped and never copied,
+# edits append to an add buffer, and the document is a list of pieces
+# pointing into either buffer. Newlines of the original buffer are indexed
+# lazily in fixed-size chunks, so opening a large log only counts newlines
+# per chunk and line lookups touch one chunk.
+
+GOOEY_TEXT_CHUNK = 1 << 16
+GOOEY_TEXT_WRAP_CACHE = 1024   # wrapped lines a view keeps decoded
+
+_ORIG = 0
+_ADD = 1
+
+
+class _ChunkIndex:
+    """
+    Lazy newline index over a read-only buffer.
+    """
+    def __init__(self, buf):
+        self.buf = buf
+        self.size = len(buf)
+        counts = [buf[i:i + GOOEY_TEXT_CHUNK].count(b'\n') for i in range(0, self.size, GOOEY_TEXT_CHUNK)]
+        self.prefix = [0]
+        for n in counts:
+            self.prefix.append(self.prefix[-1] + n)
+        self.offsets = {}
+
+    def _chunk_offsets(self, c):
+        offs = self.offsets.get(c)
+        if offs is None:
+            base = c * GOOEY_TEXT_CHUNK
+            data = self.buf[base:base + GOOEY_TEXT_CHUNK]
+            offs = []
+            i = data.find(b'\n')
+            while i >= 0:
+                offs.append(base + i)
+                i = data.find(b'\n', i + 1)
+            self.offsets[c] = offs
+        return offs
+
+    def count_before(self, pos):
+        c = pos // GOOEY_TEXT_CHUNK
+        if c >= len(self.prefix) - 1:
+            return self.prefix[-1]
+        return self.prefix[c] + bisect_right(self._chunk_offsets(c), pos - 1)
+
+    def count(self, start, end):
+        return self.count_before(end) - self.count_before(start)
+
+    def nth(self, k):
+        """
+        Offset of the k-th newline (0-based) in the whole buffer.
+        """
+        c = bisect_right(self.prefix, k) - 1
+        return self._chunk_offsets(c)[k - self.prefix[c]]
+
+
+class GooeyPieceTable:
+    """
+    Editable byte document. Positions are byte offsets into UTF-8 text.
+    """
+    def __init__(self, data=b""):
+        self._orig = data
+        self._add = bytearray()
+        self._index = _ChunkIndex(data)
+        self._pieces = []
+        if len(data):
+            self._pieces.append((_ORIG, 0, len(data), self._index.prefix[-1]))
+        self._starts = None
+        self._lines = None
+        self.version = 0
+
+    @classmethod
+    def open(cls, path: str):
+        """
+        Memory-maps a file as the original buffer.
+        """
+        with open(path, "rb") as f:
+            if os.fstat(f.fileno()).st_size == 0:
+                return cls(b"")
+            return cls(mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ))
+
+    def _buffer(self, kind):
+        return self._orig if kind == _ORIG else self._add
+
+    def _newlines(self, kind, start, length):
+        if kind == _ORIG:
+            return self._index.count(start, start + length)
+        return self._add.count(b'\n', start, start + length)
+
+    def _rebuild(self):
+        if self._starts is None:
+            self._starts = [0]
+            self._lines = [0]
+            for kind, start, length, nl in self._pieces:
+                self._starts.append(self._starts[-1] + length)
+                self._lines.append(self._lines[-1] + nl)
+
+    def _changed(self):
+        self._starts = None
+        self._lines = None
+        self.version += 1
+
+    def __len__(self):
+        self._rebuild()
+        return self._starts[-1]
+
+    def _split(self, pos):
+        """
+        Ensures a piece boundary at pos and returns the index of the piece starting there.
+        """
+        self._rebuild()
+        i = bisect_right(self._starts, pos) - 1
+        if i >= len(self._pieces):
+            return len(self._pieces)
+        offset = pos - self._starts[i]
+        if offset == 0:
+            return i
+        kind, start, length, _ = self._pieces[i]
+        left = (kind, start, offset, self._newlines(kind, start, offset))
+        right = (kind, start + offset, length - offset, self._newlines(kind, start + offset, length - offset))
+        self._pieces[i:i + 1] = [left, right]
+        self._changed()
+        return i + 1
+
+    def insert(self, pos: int, text):
+        """
+        Inserts str or bytes at byte offset pos.
+        """
+        data = text.encode('utf-8') if isinstance(text, str) else bytes(text)
+        if not data:
+            return
+        start = len(self._add)
+        self._add += data
+        i = self._split(pos)
+        piece = (_ADD, start, len(data), data.count(b'\n'))
+        prev = self._pieces[i - 1] if i > 0 else None
+        if prev and prev[0] == _ADD and prev[1] + prev[2] == start:
+            # Typing appends to the previous add piece instead of growing the table.
+            self._pieces[i - 1] = (_ADD, prev[1], prev[2] + len(data), prev[3] + piece[3])
+        else:
+            self._pieces.insert(i, piece)
+        self._changed()
+
+    def delete(self, pos: int, length: int):
+        """
+        Removes length bytes starting at pos.
+        """
+        if length <= 0:
+            return
+        first = self._split(pos)
+        last = self._split(pos + length)
+        del self._pieces[first:last]
+        self._changed()
+
+    def text(self, start: int = 0, end: int = None) -> bytes:
+        """
+        Returns the bytes in [start, end).
+        """
+        self._rebuild()
+        end = self._starts[-1] if end is None else min(end, self._starts[-1])
+        out = bytearray()
+        i = max(0, bisect_right(self._starts, start) - 1)
+        while i < len(self._pieces) and self._starts[i] < end:
+            kind, pstart, length, _ = self._pieces[i]
+            lo = max(start, self._starts[i]) - self._starts[i]
+            hi = min(end, self._starts[i] + length) - self._starts[i]
+            out += self._buffer(kind)[pstart + lo:pstart + hi]
+            i += 1
+        return bytes(out)
+
+    def line_count(self) -> int:
+        self._rebuild()
+        return self._lines[-1] + 1
+
+    def line_start(self, line: int) -> int:
+        """
+        Byte offset where the given 0-based line starts.
+        """
+        if line <= 0:
+            return 0
+        self._rebuild()
+        k = line - 1
+        i = bisect_right(self._lines, k) - 1
+        if i >= len(self._pieces):
+            return self._starts[-1]
+        kind, start, length, _ = self._pieces[i]
+        k -= self._lines[i]
+        if kind == _ORIG:
+            nl = self._index.nth(self._index.count_before(start) + k)
+        else:
+            nl = start - 1
+            for _ in range(k + 1):
+                nl = self._add.find(b'\n', nl + 1)
+        return self._starts[i] + (nl - start) + 1
+
+    def line(self, line: int) -> str:
+        """
+        Returns a line without its trailing newline.
+        """
+        start = self.line_start(line)
+        end = self.line_start(line + 1) if line + 1 < self.line_count() else len(self)
+        return self.text(start, end).rstrip(b'\n').decode('utf-8', 'replace')
+
+    def next_char(self, pos: int) -> int:
+        """
+        Offset of the UTF-8 character after the one at pos.
+        """
+        size = len(self)
+        tail = self.text(pos + 1, pos + 4)
+        skip = 0
+        while skip < len(tail) and (tail[skip] & 0xC0) == 0x80:
+            skip += 1
+        return min(pos + 1 + skip, size)
+
+    def prev_char(self, pos: int) -> int:
+        """
+        Offset of the UTF-8 character before pos.
+        """
+        if pos <= 1:
+            return 0
+        head = self.text(max(0, pos - 4), pos)
+        i = len(head) - 1
+        while i > 0 and (head[i] & 0xC0) == 0x80:
+            i -= 1
+        return pos - len(head) + i
+
+
+class GooeyTextView:
+    """
+    Virtualized multi-line view: a fixed pool of labels shows the visible
+    rows of a GooeyPieceTable. Long lines are wrapped at wrap_chars; the
+    wrapped rows of the last GOOEY_TEXT_WRAP_CACHE lines shown are kept until
+    the document changes.
+    """
+    def __init__(self, model: GooeyPieceTable, labels, wrap_chars: int = 120):
+        self.model = model
+        self.labels = labels
+        self.wrap_chars = wrap_chars
+        self.first_line = 0
+        self._wrap_cache = OrderedDict()
+        self._version = model.version
+
+    def _rows(self, line):
+        rows = self._wrap_cache.get(line)
+        if rows is not None:
+            self._wrap_cache.move_to_end(line)
+            return rows
+        text = self.model.line(line)
+        rows = [text[i:i + self.wrap_chars] for i in range(0, len(text), self.wrap_chars)] or [""]
+        self._wrap_cache[line] = rows
+        if len(self._wrap_cache) > GOOEY_TEXT_WRAP_CACHE:
+            self._wrap_cache.popitem(last=False)
+        return rows
+
+    def scroll_to_line(self, line: int):
+        """
+        Shows rows starting at the first row of the given line and refreshes the labels.
+        """
+        if self.model.version != self._version:
+            self._wrap_cache.clear()
+            self._version = self.model.version
+        line = max(0, min(line, self.model.line_count() - 1))
+        self.first_line = line
+        shown = []
+        while len(shown) < len(self.labels) and line < self.model.line_count():
+            shown.extend(self._rows(line))
+            line += 1
+        shown = shown[:len(self.labels)]
+        shown += [""] * (len(self.labels) - len(shown))
+        for label, text in zip(self.labels, shown):
+            GooeyLabel_SetText(label, text)
@@ -16,18 +16,21 @@ along with this program. If not, see <https://www.gnu.org/licenses/>.
 """
 
 from libgooey import *
+from gooey_window import GooeyWindow_ScheduleRedraw
 import ctypes
+import json
+import os
 
 # Theme Structure
 class GooeyTheme(ctypes.Structure):
     _fields_ = [
-        ("base", ctypes.c_uint32),
-        ("neutral", ctypes.c_uint32),
-        ("primary", ctypes.c_uint32),
-        ("widget_base", ctypes.c_uint32),
-        ("danger", ctypes.c_uint32),
-        ("info", ctypes.c_uint32),
-        ("success", ctypes.c_uint32)
+        ("base", ctypes.c_ulong),
+        ("neutral", ctypes.c_ulong),
+        ("widget_base", ctypes.c_ulong),
+        ("primary", ctypes.c_ulong),
+        ("danger", ctypes.c_ulong),
+        ("info", ctypes.c_ulong),
+        ("success", ctypes.c_ulong)
     ]
 
 # Theme Function Bindings
@@ -195,4 +198,81 @@ class ThemeManager:
         
     def __exit__(self, exc_type, exc_val, exc_tb):
         if self.theme_ptr:
-            GooeyTheme_Destroy(self.theme_ptr)
\ No newline at end of file
+            GooeyTheme_Destroy(self.theme_ptr)
+
+
+# --- Theme cache and switching ---
+#
+# Theme files are compiled once into a table of the seven colors in
+# GooeyTheme field order and kept in memory, keyed by the file's path, size
+# and mtime, so switching back to a theme neither reads nor parses it again.
+#
+# Windows attached with GooeyTheme_Attach all point at one shared native
+# GooeyTheme. Switching themes writes the new table into that struct once and
+# schedules a redraw of each attached window, instead of loading and setting
+# a separate theme per window.
+
+GOOEY_THEME_FIELDS = tuple(name for name, _ in GooeyTheme._fields_)
+
+_DEFAULT_TABLE = tuple(getattr(CreateTheme(), name) for name in GOOEY_THEME_FIELDS)
+
+_compiled = {}
+_shared_theme = None
+_attached = []
+
+def _parse_color(value):
+    return int(value, 16) if isinstance(value, str) else int(value)
+
+def GooeyTheme_Compile(theme_path: str) -> tuple:
+    """
+    Returns the color table for a theme file, in GooeyTheme field order.
+    """
+    st = os.stat(theme_path)
+    key = (os.path.realpath(theme_path), st.st_size, st.st_mtime_ns)
+    table = _compiled.get(key)
+    if table is None:
+        with open(theme_path, "rb") as f:
+            values = json.load(f)
+        table = tuple(_parse_color(values[name]) if name in values else default
+                      for name, default in zip(GOOEY_THEME_FIELDS, _DEFAULT_TABLE))
+        _compiled[key] = table
+    return table
+
+def _shared():
+    global _shared_theme
+    if _shared_theme is None:
+        # Let the library allocate the struct so it owns it like any loaded theme.
+        theme = GooeyTheme_LoadFromString(json.dumps(
+            {name: f"0x{value:06X}" for name, value in zip(GOOEY_THEME_FIELDS, _DEFAULT_TABLE)}))
+        if not theme:
+            raise RuntimeError("Failed to allocate the shared theme")
+        _shared_theme = theme
+    return _shared_theme
+
+def GooeyTheme_Switch(theme):
+    """
+    Switches every attached window to theme, a theme file path or a color table.
+    """
+    table = GooeyTheme_Compile(theme) if isinstance(theme, str) else tuple(theme)
+    shared = _shared().contents
+    for name, value in zip(GOOEY_THEME_FIELDS, table):
+        setattr(shared, name, value)
+    for window in _attached:
+        GooeyWindow_ScheduleRedraw(window)
+
+def GooeyTheme_Attach(window, theme=None):
+    """
+    Makes window follow the shared theme, optionally switching to theme first.
+    """
+    shared = _shared()
+    if theme is not None:
+        GooeyTheme_Switch(theme)
+    GooeyWindow_SetTheme(window, shared)
+    _attached.append(window)
+
+def GooeyTheme_Detach(window):
+    """
+    Stops redrawing window on theme switches, e.g. before it is destroyed.
+    """
+    if window in _attached:
+        _attached.remove(window)
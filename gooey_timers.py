@@ -0,0 +1,311 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+from libgooey import *
+from gooey_logger import GooeyLog_Error
+from gooey_trace import GooeyTrace_Begin, GooeyTrace_End, GooeyTrace_Name, GOOEY_TRACE_FRAME, GOOEY_TRACE_TIMER
+import ctypes
+import sys
+import threading
+import time
+import traceback
+
+class GooeyTimer(ctypes.Structure): pass
+
+GooeyTimerCallback = ctypes.CFUNCTYPE(None, ctypes.c_void_p)
+
+# GooeyTimer_Create
+c_lib.GooeyTimer_Create.argtypes = []
+c_lib.GooeyTimer_Create.restype = ctypes.POINTER(GooeyTimer)
+
+def GooeyTimer_Create():
+    """
+    Creates a new native timer object.
+    """
+    return c_lib.GooeyTimer_Create()
+
+# GooeyTimer_SetCallback
+c_lib.GooeyTimer_SetCallback.argtypes = [ctypes.c_uint64, ctypes.POINTER(GooeyTimer), GooeyTimerCallback, ctypes.c_void_p]
+c_lib.GooeyTimer_SetCallback.restype = None
+
+def GooeyTimer_SetCallback(time_ms: int, timer, callback: GooeyTimerCallback, user_data=None):
+    """
+    Arms a native timer to call the callback after time_ms milliseconds.
+    The caller must keep the callback object alive while the timer is armed.
+    """
+    c_lib.GooeyTimer_SetCallback(time_ms, timer, callback, user_data)
+
+# GooeyTimer_Stop
+c_lib.GooeyTimer_Stop.argtypes = [ctypes.POINTER(GooeyTimer)]
+c_lib.GooeyTimer_Stop.restype = None
+
+def GooeyTimer_Stop(timer):
+    """
+    Stops a native timer if it is running.
+    """
+    c_lib.GooeyTimer_Stop(timer)
+
+# GooeyTimer_Destroy
+c_lib.GooeyTimer_Destroy.argtypes = [ctypes.POINTER(GooeyTimer)]
+c_lib.GooeyTimer_Destroy.restype = None
+
+def GooeyTimer_Destroy(timer):
+    """
+    Destroys a native timer and frees its resources.
+    """
+    c_lib.GooeyTimer_Destroy(timer)
+
+
+# --- Timer wheel ---
+#
+# The native timer table is capped at MAX_TIMERS and scanned on every loop
+# iteration. Python-side timers are kept in a hierarchical timing wheel
+# instead and multiplexed onto a single native timer that is always armed
+# for the wheel's next deadline, so the event loop only ever sees one entry.
+
+GOOEY_TIMER_TICK_MS = 16     # one wheel tick, roughly one frame at 60 Hz
+GOOEY_TIMER_WHEEL_BITS = 6   # 64 slots per level
+GOOEY_TIMER_WHEEL_LEVELS = 4 # 64^4 ticks, about 74 hours of range
+
+_WHEEL_SIZE = 1 << GOOEY_TIMER_WHEEL_BITS
+_WHEEL_MASK = _WHEEL_SIZE - 1
+
+
+class GooeyTimerHandle:
+    """
+    Handle returned by GooeyTimerWheel.schedule, used to cancel a timer.
+    """
+    __slots__ = ("expires", "interval", "callback", "user_data", "slot", "cancelled")
+
+    def __init__(self, expires, interval, callback, user_data):
+        self.expires = expires
+        self.interval = interval
+        self.callback = callback
+        self.user_data = user_data
+        self.slot = None
+        self.cancelled = False
+
+
+class GooeyTimerWheel:
+    """
+    Hierarchical timing wheel with O(1) schedule and cancel.
+    All timers expiring within the same tick are fired from one advance() call.
+    """
+    def __init__(self, clock=time.monotonic):
+        self._clock = clock
+        self._origin = clock()
+        self._current = 0
+        self._count = 0
+        self._lock = threading.RLock()
+        self._levels = [[set() for _ in range(_WHEEL_SIZE)] for _ in range(GOOEY_TIMER_WHEEL_LEVELS)]
+
+    def _now_tick(self):
+        return int((self._clock() - self._origin) * 1000) // GOOEY_TIMER_TICK_MS
+
+    def _insert(self, handle, allow_current=False):
+        if handle.expires <= self._current and not allow_current:
+            handle.expires = self._current + 1
+        delta = handle.expires - self._current
+        for level in range(GOOEY_TIMER_WHEEL_LEVELS):
+            shift = GOOEY_TIMER_WHEEL_BITS * level
+            if delta < (_WHEEL_SIZE << shift):
+                slot = self._levels[level][(handle.expires >> shift) & _WHEEL_MASK]
+                break
+        else:
+            # Beyond the wheel's range: park in the farthest slot and let the
+            # cascade re-evaluate it when that slot comes around.
+            shift = GOOEY_TIMER_WHEEL_BITS * (GOOEY_TIMER_WHEEL_LEVELS - 1)
+            slot = self._levels[-1][((self._current >> shift) - 1) & _WHEEL_MASK]
+        slot.add(handle)
+        handle.slot = slot
+
+    def _cascade(self, level):
+        shift = GOOEY_TIMER_WHEEL_BITS * level
+        slot = self._levels[level][(self._current >> shift) & _WHEEL_MASK]
+        pending = list(slot)
+        slot.clear()
+        for handle in pending:
+            self._insert(handle, allow_current=True)
+
+    def schedule(self, delay_ms: int, callback, user_data=None, interval_ms: int = 0):
+        """
+        Schedules callback(user_data) after delay_ms milliseconds.
+        A non-zero interval_ms makes the timer repeat until cancelled.
+        """
+        with self._lock:
+            now = self._now_tick()
+            if self._count == 0:
+                self._current = now
+            ticks = max(1, -(-int(delay_ms) // GOOEY_TIMER_TICK_MS))
+            interval = -(-int(interval_ms) // GOOEY_TIMER_TICK_MS) if interval_ms > 0 else 0
+            handle = GooeyTimerHandle(now + ticks, interval, callback, user_data)
+            self._insert(handle)
+            self._count += 1
+            return handle
+
+    def cancel(self, handle: GooeyTimerHandle):
+        """
+        Cancels a scheduled timer. Cancelling twice is harmless.
+        """
+        with self._lock:
+            if handle.cancelled:
+                return
+            handle.cancelled = True
+            if handle.slot is not None:
+                handle.slot.discard(handle)
+                handle.slot = None
+                self._count -= 1
+
+    def pending(self) -> int:
+        """
+        Returns the number of armed timers.
+        """
+        return self._count
+
+    def advance(self):
+        """
+        Runs every timer that expired since the last call.
+        Returns the number of callbacks fired.
+        """
+        due = []
+        with self._lock:
+            target = self._now_tick()
+            if self._count == 0:
+                self._current = max(self._current, target)
+                return 0
+            while self._current < target and self._count:
+                self._current += 1
+                for level in range(GOOEY_TIMER_WHEEL_LEVELS - 1, 0, -1):
+                    if self._current & ((1 << (GOOEY_TIMER_WHEEL_BITS * level)) - 1) == 0:
+                        self._cascade(level)
+                slot = self._levels[0][self._current & _WHEEL_MASK]
+                if not slot:
+                    continue
+                fired = list(slot)
+                slot.clear()
+                for handle in fired:
+                    handle.slot = None
+                    if handle.interval:
+                        handle.expires = self._current + handle.interval
+                        self._insert(handle)
+                    else:
+                        self._count -= 1
+                    due.append(handle)
+            self._current = max(self._current, target)
+        for handle in due:
+            if not handle.cancelled:
+                span = GooeyTrace_Begin(GOOEY_TRACE_TIMER, handle.callback)
+                try:
+                    handle.callback(handle.user_data)
+                except Exception:
+                    # One failing callback must not lose the others already taken off the wheel.
+                    error = traceback.format_exc()
+                    GooeyLog_Error("timer callback %s raised:\n%s", GooeyTrace_Name(handle.callback), error)
+                    sys.stderr.write(error)
+                finally:
+                    GooeyTrace_End(span)
+        return len(due)
+
+    def next_deadline(self):
+        """
+        Returns the number of milliseconds until the next timer may fire,
+        or None when no timer is armed. Timers parked in the upper levels
+        count at the time of their cascade, which is never later than their
+        expiry, so the earliest such tick over all levels is a safe bound.
+        """
+        with self._lock:
+            if self._count == 0:
+                return None
+            earliest = None
+            for level in range(GOOEY_TIMER_WHEEL_LEVELS):
+                shift = GOOEY_TIMER_WHEEL_BITS * level
+                base = self._current >> shift
+                for offset in range(1, _WHEEL_SIZE + 1):
+                    if self._levels[level][(base + offset) & _WHEEL_MASK]:
+                        tick = max((base + offset) << shift, self._current + 1)
+                        if earliest is None or tick < earliest:
+                            earliest = tick
+                        break
+            if earliest is None:
+                return None
+            now = (self._clock() - self._origin) * 1000
+            return max(0, int(earliest * GOOEY_TIMER_TICK_MS - now))
+
+
+# --- Native integration ---
+#
+# Only the UI thread (the main thread, which runs GooeyWindow_Run) touches the
+# native timer. Other threads may schedule wheel timers, which just enqueues
+# them under the wheel's lock; the native timer is never armed for longer
+# than GOOEY_TIMER_POLL_MS, so the UI thread picks such timers up within that
+# time even when the wheel was idle. The poll starts with the first timer
+# scheduled from the UI thread.
+
+GOOEY_TIMER_POLL_MS = 50
+
+_wheel = GooeyTimerWheel()
+_native_timer = None
+_native_deadline = None
+_ui_thread = threading.main_thread()
+
+def _native_fire(user_data):
+    global _native_deadline
+    _native_deadline = None
+    span = GooeyTrace_Begin(GOOEY_TRACE_FRAME, "tick")
+    try:
+        _wheel.advance()
+    finally:
+        _rearm()
+        GooeyTrace_End(span)
+
+_native_callback = GooeyTimerCallback(_native_fire)
+
+def _rearm():
+    global _native_timer, _native_deadline
+    if threading.current_thread() is not _ui_thread:
+        return
+    delay = _wheel.next_deadline()
+    delay = GOOEY_TIMER_POLL_MS if delay is None else min(delay, GOOEY_TIMER_POLL_MS)
+    deadline = time.monotonic() + delay / 1000.0
+    if _native_deadline is not None and _native_deadline <= deadline:
+        return
+    if _native_timer is None:
+        _native_timer = GooeyTimer_Create()
+    _native_deadline = deadline
+    GooeyTimer_SetCallback(max(1, delay), _native_timer, _native_callback, None)
+
+def GooeyTimerWheel_Schedule(delay_ms: int, callback, user_data=None, interval_ms: int = 0) -> GooeyTimerHandle:
+    """
+    Schedules a Python timer on the shared wheel. Unlike GooeyTimer_Create
+    this is not limited by MAX_TIMERS; all wheel timers share one native timer.
+    Callbacks always run on the UI thread, whichever thread schedules them.
+    """
+    handle = _wheel.schedule(delay_ms, callback, user_data, interval_ms)
+    _rearm()
+    return handle
+
+def GooeyTimerWheel_Cancel(handle: GooeyTimerHandle):
+    """
+    Cancels a timer scheduled with GooeyTimerWheel_Schedule.
+    """
+    _wheel.cancel(handle)
+
+def GooeyTimerWheel_NextDeadline():
+    """
+    Returns milliseconds until the next wheel timer, or None if idle.
+    """
+    return _wheel.next_deadline()
@@ -0,0 +1,185 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+import itertools
+import mmap
+import os
+import struct
+import sys
+import threading
+import time
+
+# --- Post-mortem trace ---
+#
+# A fixed-size circular buffer of trace records in a memory-mapped file.
+# Frame ticks, event dispatch, timer fires and redraw flushes write one
+# record each when they start; spans patch their duration into the same
+# record when they end, so a span still marked open in the file is what the
+# loop was doing when it hung or died. The mapping is shared with the page
+# cache, so the file stays readable after a crash without any flush.
+#
+# Tracing is off unless GOOEY_TRACE names a file (or GooeyTrace_Open is
+# called); hooks then cost one global check, and span names are only built
+# once a record is actually written. Decode a trace with
+#
+#   python3 gooey_trace.py decode /tmp/gooey.trace [--last 200]
+#
+# Layout: a 64-byte header, then `capacity` 64-byte records. Record n lives
+# in slot n % capacity; the header holds the next sequence number.
+
+GOOEY_TRACE_MAGIC = b"GOOEYTR1"
+GOOEY_TRACE_CAPACITY = 16384   # 1 MiB of records
+
+GOOEY_TRACE_FRAME = 1
+GOOEY_TRACE_EVENT = 2
+GOOEY_TRACE_TIMER = 3
+GOOEY_TRACE_DRAW = 4
+GOOEY_TRACE_MARK = 5
+
+_KIND_NAMES = {GOOEY_TRACE_FRAME: "frame", GOOEY_TRACE_EVENT: "event", GOOEY_TRACE_TIMER: "timer",
+               GOOEY_TRACE_DRAW: "draw", GOOEY_TRACE_MARK: "mark"}
+
+_HEADER = struct.Struct("<8sIIIIQQ")       # magic, version, record size, capacity, pid, start (unix ns), next seq
+_RECORD = struct.Struct("<QQQIB3x32s")     # seq, start ns, duration ns, thread, kind, name
+_HEADER_SIZE = 64
+_OPEN = 0xFFFFFFFFFFFFFFFF                 # duration of a span that has not ended
+
+_map = None
+_file = None
+_capacity = 0
+_origin = 0
+_seq = None
+
+
+def GooeyTrace_Open(path: str, capacity: int = GOOEY_TRACE_CAPACITY) -> bool:
+    """
+    Starts tracing into path, replacing any previous trace there.
+    """
+    global _map, _file, _capacity, _origin, _seq
+    GooeyTrace_Close()
+    try:
+        f = open(path, "w+b")
+        f.truncate(_HEADER_SIZE + capacity * _RECORD.size)
+        m = mmap.mmap(f.fileno(), 0)
+    except OSError:
+        return False
+    _origin = time.monotonic_ns()
+    _HEADER.pack_into(m, 0, GOOEY_TRACE_MAGIC, 1, _RECORD.size, capacity, os.getpid(), time.time_ns(), 1)
+    _file, _capacity, _seq = f, capacity, itertools.count(1)
+    _map = m
+    return True
+
+
+def GooeyTrace_Close():
+    global _map, _file
+    if _map is None:
+        return
+    m, _map = _map, None
+    m.flush()
+    m.close()
+    _file.close()
+    _file = None
+
+
+def GooeyTrace_Begin(kind: int, name, *args) -> int:
+    """
+    Records the start of a span; pass the result to GooeyTrace_End. Returns 0 when tracing is off.
+    name is a string (formatted with args, if any), bytes, or a callable named by GooeyTrace_Name.
+    """
+    m = _map
+    if m is None:
+        return 0
+    seq = next(_seq)
+    if isinstance(name, str):
+        name = (name % args if args else name).encode("utf-8", "replace")
+    elif not isinstance(name, bytes):
+        name = GooeyTrace_Name(name).encode("utf-8", "replace")
+    _RECORD.pack_into(m, _HEADER_SIZE + (seq % _capacity) * _RECORD.size,
+                      seq, time.monotonic_ns() - _origin, _OPEN, threading.get_native_id() & 0xFFFFFFFF, kind, name)
+    struct.pack_into("<Q", m, 32, seq + 1)
+    return seq
+
+
+def GooeyTrace_End(seq: int):
+    """
+    Closes a span, unless the ring has already wrapped over its record.
+    """
+    m = _map
+    if m is None or not seq:
+        return
+    offset = _HEADER_SIZE + (seq % _capacity) * _RECORD.size
+    recorded, start = struct.unpack_from("<QQ", m, offset)
+    if recorded == seq:
+        struct.pack_into("<Q", m, offset + 16, time.monotonic_ns() - _origin - start)
+
+
+def GooeyTrace_Mark(kind: int, name, *args):
+    """
+    Records an instant.
+    """
+    GooeyTrace_End(GooeyTrace_Begin(kind, name, *args))
+
+
+def GooeyTrace_Name(fn) -> str:
+    return getattr(fn, "__qualname__", None) or getattr(fn, "__name__", None) or type(fn).__name__
+
+
+def GooeyTrace_Read(path: str):
+    """
+    Returns (header dict, records oldest first) from a trace file.
+    """
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, version, record_size, capacity, pid, start, next_seq = _HEADER.unpack_from(data, 0)
+    if magic != GOOEY_TRACE_MAGIC or record_size != _RECORD.size:
+        raise ValueError(f"{path}: not a gooey trace")
+    records = []
+    for slot in range(capacity):
+        seq, t, duration, thread, kind, name = _RECORD.unpack_from(data, _HEADER_SIZE + slot * record_size)
+        if seq:
+            records.append((seq, t, None if duration == _OPEN else duration, thread, kind,
+                            name.rstrip(b"\0").decode("utf-8", "replace")))
+    records.sort()
+    header = {"version": version, "capacity": capacity, "pid": pid, "start": start, "next_seq": next_seq}
+    return header, records
+
+
+def _decode(path, last=None):
+    header, records = GooeyTrace_Read(path)
+    if last:
+        records = records[-last:]
+    started = time.strftime("%Y-%m-%d %H:%M:%S", time.localtime(header["start"] / 1e9))
+    print(f"pid {header['pid']}, started {started}, {header['next_seq'] - 1} records written, "
+          f"{len(records)} shown")
+    print(f"{'time ms':>12} {'dur ms':>9}  {'thread':>7}  {'kind':<6} name")
+    for seq, t, duration, thread, kind, name in records:
+        dur = "OPEN" if duration is None else f"{duration / 1e6:.3f}"
+        print(f"{t / 1e6:12.3f} {dur:>9}  {thread:>7}  {_KIND_NAMES.get(kind, kind):<6} {name}")
+    hung = [r for r in records if r[2] is None]
+    if hung:
+        print(f"\n{len(hung)} open span(s); innermost: {_KIND_NAMES.get(hung[-1][4])} {hung[-1][5]}")
+
+
+if os.environ.get("GOOEY_TRACE") and __name__ != "__main__":
+    GooeyTrace_Open(os.environ["GOOEY_TRACE"])
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3 or sys.argv[1] != "decode":
+        print("usage: gooey_trace.py decode TRACE_FILE [--last N]")
+        sys.exit(2)
+    _decode(sys.argv[2], int(sys.argv[sys.argv.index("--last") + 1]) if "--last" in sys.argv else None)
@@ -0,0 +1,185 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+from gooey_button import GooeyButton_Create
+from gooey_canvas import GooeyCanvas_Create, GooeyCanvas_DrawRectangle
+from gooey_checkbox import GooeyCheckbox_Create
+from gooey_container import GooeyContainer_AddWidgets
+from gooey_image import GooeyImage_Create
+from gooey_label import GooeyLabel_Create, GooeyLabel_SetColor
+import hashlib
+import json
+import marshal
+import mmap
+import os
+import sys
+
+# --- Declarative pages ---
+#
+# A UI file is JSON: {"pages": {"name": [widget, ...]}}. Each widget is an
+# object with a "type" (label, lines, image, canvas, button, checkbox) and
+# that widget's creation arguments; "color" names an entry of the palette
+# passed to GooeyUI_Build (or is a "0xRRGGBB" literal), "callback" names a
+# function in the callbacks mapping, and "id" makes the created widget
+# available to the caller.
+#
+# Compiling validates the file, expands "lines" blocks into labels and
+# flattens every widget into a positional tuple. At build time
+# `python3 gooey_ui.py pages/installer.json` stores the compiled form next to
+# the source with marshal, stamped with a hash of the source; at run time the
+# stamp is checked and the blob memory-mapped, so JSON parsing and
+# validation are skipped. The installer never writes the cache itself; a
+# missing or stale blob just means compiling in memory.
+
+GOOEY_UI_MAGIC = b"GOOEYUI1"
+GOOEY_UI_CACHE_SUFFIX = ".bin"
+
+_FIELDS = {
+    "label": ("text", "size", "x", "y"),
+    "image": ("path", "x", "y", "w", "h"),
+    "canvas": ("x", "y", "w", "h"),
+    "button": ("text", "x", "y", "w", "h"),
+    "checkbox": ("x", "y", "text"),
+}
+_DEFAULTS = {"size": 0.26}
+
+
+def _compile_widget(page, widget):
+    kind = widget.get("type")
+    if kind == "lines":
+        x, y = widget["x"], widget["y"]
+        step = widget.get("step", 18)
+        size = widget.get("size", _DEFAULTS["size"])
+        return [("label", (text, size, x, y + i * step), widget.get("color"), None, None, ())
+                for i, text in enumerate(widget["lines"])]
+    if kind not in _FIELDS:
+        raise ValueError(f"page '{page}': unknown widget type {kind!r}")
+    try:
+        args = tuple(widget[f] if f in widget else _DEFAULTS[f] for f in _FIELDS[kind])
+    except KeyError as e:
+        raise ValueError(f"page '{page}': {kind} is missing {e.args[0]!r}")
+    rects = tuple((r["x"], r["y"], r["w"], r["h"], r["color"], r.get("filled", True))
+                  for r in widget.get("rects", ()))
+    return [(kind, args, widget.get("color"), widget.get("callback"), widget.get("id"), rects)]
+
+
+def GooeyUI_Compile(source: bytes) -> dict:
+    """
+    Compiles UI JSON into {page: [(type, args, color, callback, id, rects), ...]}.
+    """
+    doc = json.loads(source)
+    pages = {}
+    for page, widgets in doc.get("pages", {}).items():
+        flat = []
+        for widget in widgets:
+            flat.extend(_compile_widget(page, widget))
+        pages[page] = flat
+    return pages
+
+
+def _stamp(source: bytes) -> bytes:
+    return hashlib.blake2b(source, digest_size=16).digest()
+
+def _read_cache(cache, stamp):
+    try:
+        with open(cache, "rb") as f, mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as m:
+            if m[:len(GOOEY_UI_MAGIC)] != GOOEY_UI_MAGIC:
+                return None
+            view = memoryview(m)
+            try:
+                cached_stamp, pages = marshal.loads(view[len(GOOEY_UI_MAGIC):])
+            finally:
+                view.release()
+    except (OSError, ValueError, EOFError, TypeError):
+        return None
+    return pages if cached_stamp == stamp else None
+
+def _write_cache(cache, stamp, pages):
+    tmp = cache + ".tmp"
+    with open(tmp, "wb") as f:
+        f.write(GOOEY_UI_MAGIC + marshal.dumps((stamp, pages)))
+    os.replace(tmp, cache)
+
+
+def GooeyUI_Load(path: str) -> dict:
+    """
+    Loads a UI file, using its precompiled blob when it matches the source.
+    """
+    with open(path, "rb") as f:
+        source = f.read()
+    pages = _read_cache(path + GOOEY_UI_CACHE_SUFFIX, _stamp(source))
+    return pages if pages is not None else GooeyUI_Compile(source)
+
+
+def _color(value, palette):
+    if value is None or isinstance(value, int):
+        return value
+    if value.startswith("0x"):
+        return int(value, 16)
+    return palette[value]
+
+def _callback(name, callbacks):
+    if name is None:
+        return None
+    try:
+        return callbacks[name]
+    except KeyError:
+        raise KeyError(f"UI callback '{name}' is not defined")
+
+
+def GooeyUI_Build(window, container, container_id: int, pages: dict, page: str,
+                  callbacks, palette, default_callbacks=None) -> dict:
+    """
+    Creates the widgets of one page and adds them to a container page in
+    document order. callbacks maps names to callback objects; widgets that
+    need a callback but name none use default_callbacks[type]. Returns the
+    widgets that have an "id".
+    """
+    default_callbacks = default_callbacks or {}
+    widgets = []
+    named = {}
+    for kind, args, color, callback, widget_id, rects in pages[page]:
+        cb = _callback(callback, callbacks) if callback else default_callbacks.get(kind)
+        if kind == "label":
+            widget = GooeyLabel_Create(*args)
+        elif kind == "image":
+            widget = GooeyImage_Create(*args, cb)
+        elif kind == "canvas":
+            widget = GooeyCanvas_Create(*args, cb)
+            for x, y, w, h, rect_color, filled in rects:
+                GooeyCanvas_DrawRectangle(widget, x, y, w, h, _color(rect_color, palette), filled, 1.0, False, 0.0)
+        elif kind == "button":
+            widget = GooeyButton_Create(*args, cb)
+        else:
+            widget = GooeyCheckbox_Create(*args, cb)
+        if color is not None and kind == "label":
+            GooeyLabel_SetColor(widget, _color(color, palette))
+        if widget_id:
+            named[widget_id] = widget
+        widgets.append(widget)
+    GooeyContainer_AddWidgets(window, container, container_id, widgets)
+    return named
+
+
+if __name__ == "__main__":
+    # Precompile UI files, e.g. before packaging: python3 gooey_ui.py pages/installer.json
+    for ui_path in sys.argv[1:]:
+        with open(ui_path, "rb") as f:
+            source = f.read()
+        compiled = GooeyUI_Compile(source)
+        _write_cache(ui_path + GOOEY_UI_CACHE_SUFFIX, _stamp(source), compiled)
+        print(f"{ui_path}: {sum(len(w) for w in compiled.values())} widgets in {len(compiled)} pages")
@@ -1,9 +1,18 @@
 from libgooey import *
 import ctypes
 
-# Define the GooeyWidget struct and pointer type
+# Define the GooeyWidget struct and pointer type.
+# Mirrors the `core` member every widget struct starts with.
 class GooeyWidget(ctypes.Structure):
-    pass
+    _fields_ = [
+        ("sprite", ctypes.c_void_p),
+        ("type", ctypes.c_int),
+        ("is_visible", ctypes.c_bool),
+        ("x", ctypes.c_int),
+        ("y", ctypes.c_int),
+        ("width", ctypes.c_int),
+        ("height", ctypes.c_int)
+    ]
 
 # --- GooeyWidget_MakeVisible ---
 c_lib.GooeyWidget_MakeVisible.argtypes = [ctypes.c_void_p, ctypes.c_bool]
@@ -33,4 +42,19 @@ def GooeyWidget_Resize(widget: ctypes.c_void_p, w: int, h: int):
     """
     Resize widget
     """
-    c_lib.GooeyWidget_Resize(widget, w, h)
\ No newline at end of file
+    c_lib.GooeyWidget_Resize(widget, w, h)
+
+# --- GooeyWidget_GetGeometry ---
+def GooeyWidget_GetGeometry(widget):
+    """
+    Returns the (x, y, width, height) of any widget pointer
+    """
+    core = ctypes.cast(widget, ctypes.POINTER(GooeyWidget)).contents
+    return (core.x, core.y, core.width, core.height)
+
+# --- GooeyWidget_Address ---
+def GooeyWidget_Address(widget) -> int:
+    """
+    Returns the address of a widget pointer, used to key per-widget state
+    """
+    return widget if isinstance(widget, int) else ctypes.cast(widget, ctypes.c_void_p).value
@@ -17,8 +17,20 @@
 
 
 from libgooey import *
+from gooey_timers import GooeyTimerWheel_Schedule
+from gooey_latency import GooeyLatency_Presented
+from gooey_trace import GooeyTrace_Begin, GooeyTrace_End, GOOEY_TRACE_DRAW
 
 
+# Leading fields of the C GooeyWindow struct, enough to read the current size.
+class GooeyWindowHeader(ctypes.Structure):
+    _fields_ = [
+        ("type", ctypes.c_int),
+        ("creation_id", ctypes.c_int),
+        ("width", ctypes.c_int),
+        ("height", ctypes.c_int)
+    ]
+
 # --- Debug  ---
 #void GooeyWindow_EnableDebugOverlay(GooeyWindow *win, bool is_enabled)
 c_lib.GooeyWindow_EnableDebugOverlay.argtypes = [ctypes.c_void_p, ctypes.c_bool]
@@ -44,23 +56,24 @@ def GooeyWindow_Create(title: str, width: int, height: int, visibiliy: bool) ->
     """
     return c_lib.GooeyWindow_Create(title.encode('utf-8'), width, height, visibiliy)
 
-# void GooeyWindow_Run(int num_windows, void* window);
+# void GooeyWindow_Run(int num_windows, GooeyWindow *first_win, ...);
+# Variadic: only the fixed parameters are declared, extra windows are passed as c_void_p.
 c_lib.GooeyWindow_Run.argtypes = [ctypes.c_int, ctypes.c_void_p]
 c_lib.GooeyWindow_Run.restype = None
-#TODO: FIX THIS ASAP ON C SIDE
-def GooeyWindow_Run(num_windows: int, window: ctypes.c_void_p):
+def GooeyWindow_Run(num_windows: int, window: ctypes.c_void_p, *windows):
     """
-    Run the Gooey windows.
+    Run the Gooey windows. All windows are driven by a single event loop.
     """
-    c_lib.GooeyWindow_Run(num_windows, window)
+    c_lib.GooeyWindow_Run(num_windows, window, *[ctypes.c_void_p(w) for w in windows])
 
+# void GooeyWindow_Cleanup(int num_windows, GooeyWindow *first_win, ...);
 c_lib.GooeyWindow_Cleanup.argtypes = [ctypes.c_int, ctypes.c_void_p]
 c_lib.GooeyWindow_Cleanup.restype = None
-def GooeyWindow_Cleanup(num_windows: int, window: ctypes.c_void_p):
+def GooeyWindow_Cleanup(num_windows: int, window: ctypes.c_void_p, *windows):
     """
     Destroy the Gooey windows.
     """
-    c_lib.GooeyWindow_Cleanup(num_windows, window)
+    c_lib.GooeyWindow_Cleanup(num_windows, window, *[ctypes.c_void_p(w) for w in windows])
     
 c_lib.GooeyWindow_RegisterWidget.argtypes = [ctypes.c_void_p, ctypes.c_void_p]
 c_lib.GooeyWindow_RegisterWidget.restype = None
@@ -70,6 +83,15 @@ def GooeyWindow_RegisterWidget(window: ctypes.c_void_p, widget: ctypes.c_void_p)
     """
     c_lib.GooeyWindow_RegisterWidget(window, widget)
 
+def GooeyWindow_RegisterWidgets(window: ctypes.c_void_p, widgets):
+    """
+    Register several widgets with the Gooey window.
+    Convenience loop; each widget is still registered with its own native call.
+    """
+    register = c_lib.GooeyWindow_RegisterWidget
+    for widget in widgets:
+        register(window, widget)
+
 c_lib.GooeyWindow_MakeResizable.argtypes = [ctypes.c_void_p, ctypes.c_bool]
 c_lib.GooeyWindow_MakeResizable.restype = None
 def GooeyWindow_MakeResizable(window: ctypes.c_void_p, state: ctypes.c_bool):
@@ -84,4 +106,56 @@ def GooeyWindow_RequestCleanup(window: ctypes.c_void_p):
     """
     Request cleanup for a Gooey window.
     """
-    c_lib.GooeyWindow_RequestCleanup(window)
\ No newline at end of file
+    c_lib.GooeyWindow_RequestCleanup(window)
+
+def GooeyWindow_GetSize(window: ctypes.c_void_p):
+    """
+    Return the current (width, height) of a Gooey window.
+    """
+    header = ctypes.cast(window, ctypes.POINTER(GooeyWindowHeader)).contents
+    return (header.width, header.height)
+
+c_lib.GooeyWindow_RequestRedraw.argtypes = [ctypes.c_void_p]
+c_lib.GooeyWindow_RequestRedraw.restype = None
+def GooeyWindow_RequestRedraw(window: ctypes.c_void_p):
+    """
+    Request a redraw of a Gooey window.
+    """
+    c_lib.GooeyWindow_RequestRedraw(window)
+
+# --- Redraw scheduling ---
+#
+# Redraw requests are collected per frame and flushed once, so only windows
+# that were actually damaged are redrawn, and each of them at most once per
+# frame no matter how many widgets changed.
+
+_damaged_windows = set()
+_redraw_frame = None
+
+def _flush_redraws(user_data):
+    global _redraw_frame
+    _redraw_frame = None
+    pending = list(_damaged_windows)
+    _damaged_windows.clear()
+    span = GooeyTrace_Begin(GOOEY_TRACE_DRAW, "redraw %d window(s)", len(pending))
+    try:
+        for window in pending:
+            GooeyWindow_RequestRedraw(window)
+    finally:
+        GooeyTrace_End(span)
+    GooeyLatency_Presented()
+
+def GooeyWindow_ScheduleRedraw(window: ctypes.c_void_p):
+    """
+    Mark a window as damaged; it is redrawn once on the next frame tick.
+    """
+    global _redraw_frame
+    _damaged_windows.add(window)
+    if _redraw_frame is None:
+        _redraw_frame = GooeyTimerWheel_Schedule(0, _flush_redraws)
+
+def GooeyWindow_HasPendingRedraw() -> bool:
+    """
+    Returns True if a scheduled redraw has not been flushed yet.
+    """
+    return bool(_damaged_windows)
@@ -0,0 +1,125 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+import json
+import os
+from concurrent.futures import ThreadPoolExecutor
+
+from installer_copy import file_digest, trusted_stat, COPY_WORKERS
+
+# --- Install manifest ---
+#
+# Every install records the files it placed (size, mtime and content hash)
+# in a manifest. Reinstall and modify diff the new file set against it:
+# files whose destination still matches the manifest and whose source hash
+# is unchanged are skipped, changed or missing files are copied, and files
+# the new selection no longer contains are removed.
+#
+# The installer runs as root and deletes what the manifest lists, so a
+# manifest is only trusted if it is owned by root (or by the user running
+# the installer) and writable by nobody else, and removals are limited to
+# paths that resolve inside the install's own destination directories.
+
+MANIFEST_VERSION = 1
+MANIFEST_NAME = "install-manifest.json"
+
+
+def manifest_path(install_root: str) -> str:
+    return os.path.join(install_root, "share", "GooeyFramework", MANIFEST_NAME)
+
+
+def hash_files(paths, workers: int = COPY_WORKERS) -> dict:
+    """
+    Hashes files in parallel; hashlib releases the GIL on large buffers.
+    """
+    paths = list(paths)
+    with ThreadPoolExecutor(max_workers=workers) as pool:
+        return dict(zip(paths, pool.map(file_digest, paths)))
+
+
+def _within(path: str, roots) -> bool:
+    real = os.path.realpath(path)
+    return any(os.path.commonpath([real, root]) == root for root in roots)
+
+
+class InstallManifest:
+    def __init__(self, path: str):
+        self.path = path
+        self.files = {}
+        try:
+            fd = os.open(path, os.O_RDONLY | getattr(os, "O_NOFOLLOW", 0))
+        except OSError:
+            return
+        with os.fdopen(fd) as f:
+            if not trusted_stat(os.fstat(fd)):
+                return
+            try:
+                data = json.load(f)
+            except ValueError:
+                return
+        if data.get("version") == MANIFEST_VERSION:
+            self.files = data.get("files", {})
+
+    def exists(self) -> bool:
+        return bool(self.files)
+
+    def record(self, dst: str, digest: str):
+        st = os.stat(dst)
+        self.files[dst] = {"size": st.st_size, "mtime": st.st_mtime, "hash": digest}
+
+    def forget(self, dst: str):
+        self.files.pop(dst, None)
+
+    def save(self):
+        os.makedirs(os.path.dirname(self.path), exist_ok=True)
+        tmp = self.path + ".tmp"
+        try:
+            os.unlink(tmp)
+        except FileNotFoundError:
+            pass
+        fd = os.open(tmp, os.O_WRONLY | os.O_CREAT | os.O_EXCL | getattr(os, "O_NOFOLLOW", 0), 0o644)
+        with os.fdopen(fd, "w") as f:
+            json.dump({"version": MANIFEST_VERSION, "files": self.files}, f, indent=1, sort_keys=True)
+        os.replace(tmp, self.path)
+
+    def unchanged(self, dst: str, digest: str) -> bool:
+        """
+        True if dst is still the file this manifest recorded for the same source content.
+        """
+        entry = self.files.get(dst)
+        if entry is None or entry["hash"] != digest:
+            return False
+        try:
+            st = os.stat(dst)
+        except OSError:
+            return False
+        return st.st_size == entry["size"] and st.st_mtime == entry["mtime"]
+
+    def diff(self, jobs, digests: dict, roots=()):
+        """
+        Splits (src, dst) jobs into (to_copy, unchanged) and returns the
+        destinations recorded earlier that are no longer part of the install
+        and resolve inside one of the roots directories.
+        """
+        roots = [os.path.realpath(root) for root in roots]
+        to_copy = []
+        unchanged = []
+        for src, dst in jobs:
+            (unchanged if self.unchanged(dst, digests[src]) else to_copy).append((src, dst))
+        wanted = {dst for _, dst in jobs}
+        removed = [dst for dst in self.files if dst not in wanted and _within(dst, roots)]
+        return to_copy, unchanged, removed
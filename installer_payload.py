@@ -0,0 +1,206 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+import hashlib
+import json
+import lzma
+import mmap
+import os
+import struct
+import sys
+import zlib
+
+# --- Packed payload ---
+#
+# lib/, include/, docs/ and examples/ can ship as one payload file instead of
+# thousands of loose files. The layout is
+#
+#   header | blob data ... | directory table
+#
+# The header gives the offset and size of the directory table, a zlib
+# compressed JSON document listing each blob (offset, compressed size, size,
+# codec, BLAKE2b digest) and each entry (path, mode, mtime, blob). Identical
+# files share one blob. The payload is memory-mapped at install time; the
+# directory table is the only part read up front, and entries are
+# decompressed straight from the mapping into their destination by the copy
+# engine's worker pool (zlib and lzma release the GIL while they work).
+# Blob digests match installer_copy.file_digest, so the install manifest
+# never has to hash payload contents itself.
+
+PAYLOAD_NAME = "payload.gpk"
+PAYLOAD_MAGIC = b"GOOEYPK1"
+_HEADER = struct.Struct("<8sIQQ")   # magic, version, table offset, table size
+
+CODEC_STORED = 0
+CODEC_ZLIB = 1
+CODEC_LZMA = 2
+
+# Formats that are already compressed are stored as-is.
+_INCOMPRESSIBLE = ('.png', '.jpg', '.jpeg', '.gif', '.ttf', '.woff', '.woff2', '.gz', '.zip')
+
+
+def _compress(data: bytes, codec: int):
+    if codec == CODEC_ZLIB:
+        packed = zlib.compress(data, 9)
+    elif codec == CODEC_LZMA:
+        packed = lzma.compress(data, preset=6)
+    else:
+        return data, CODEC_STORED
+    # Keep compression only when it saves at least 1/16 of the size.
+    if len(packed) > len(data) - (len(data) >> 4):
+        return data, CODEC_STORED
+    return packed, codec
+
+
+def pack(out_path: str, root: str, dirs, codec: int = CODEC_ZLIB) -> dict:
+    """
+    Packs the given directories (relative to root) into out_path.
+    Returns {"entries", "blobs", "size", "packed"} statistics.
+    """
+    blobs = []
+    by_digest = {}
+    entries = []
+    raw_size = 0
+    tmp = out_path + ".tmp"
+    with open(tmp, "wb") as out:
+        out.write(b"\0" * _HEADER.size)
+        for top in dirs:
+            for dirpath, dirnames, files in os.walk(os.path.join(root, top)):
+                dirnames.sort()
+                for name in sorted(files):
+                    path = os.path.join(dirpath, name)
+                    st = os.stat(path)
+                    with open(path, "rb") as f:
+                        data = f.read()
+                    raw_size += len(data)
+                    digest = hashlib.blake2b(data, digest_size=20).hexdigest()
+                    blob = by_digest.get(digest)
+                    if blob is None:
+                        packed, used = _compress(data, CODEC_STORED if name.lower().endswith(_INCOMPRESSIBLE) else codec)
+                        blob = by_digest[digest] = len(blobs)
+                        blobs.append([out.tell(), len(packed), len(data), used, digest])
+                        out.write(packed)
+                    rel = os.path.relpath(path, root).replace(os.sep, "/")
+                    entries.append([rel, st.st_mode & 0o7777, st.st_mtime, blob])
+        table = zlib.compress(json.dumps({"blobs": blobs, "entries": entries}, separators=(",", ":")).encode(), 9)
+        table_offset = out.tell()
+        out.write(table)
+        out.seek(0)
+        out.write(_HEADER.pack(PAYLOAD_MAGIC, 1, table_offset, len(table)))
+    os.replace(tmp, out_path)
+    return {"entries": len(entries), "blobs": len(blobs), "size": raw_size, "packed": os.path.getsize(out_path)}
+
+
+class GooeyPayload:
+    """
+    Read-only view of a payload file. Entry names are '/'-separated paths
+    relative to the packed root, e.g. "include/gooey.h".
+    Also usable as the source of installer_copy.copy_tree.
+    """
+    def __init__(self, path: str):
+        self.path = path
+        self._file = open(path, "rb")
+        self._map = mmap.mmap(self._file.fileno(), 0, access=mmap.ACCESS_READ)
+        magic, version, offset, size = _HEADER.unpack_from(self._map, 0)
+        if magic != PAYLOAD_MAGIC or version != 1:
+            raise ValueError(f"{path} is not a Gooey payload")
+        table = json.loads(zlib.decompress(self._map[offset:offset + size]))
+        self._blobs = table["blobs"]
+        self._entries = {name: (mode, mtime, blob) for name, mode, mtime, blob in table["entries"]}
+
+    def close(self):
+        self._map.close()
+        self._file.close()
+
+    def names(self, prefix: str):
+        """
+        Entry names below the directory prefix, in packing order.
+        """
+        prefix = prefix.rstrip("/") + "/" if prefix else ""
+        return [name for name in self._entries if name.startswith(prefix)]
+
+    def size(self, name: str) -> int:
+        return self._blobs[self._entries[name][2]][2]
+
+    def stamp(self, name: str):
+        mode, mtime, blob = self._entries[name]
+        return self._blobs[blob][2], mtime
+
+    def digest(self, name: str) -> str:
+        return self._blobs[self._entries[name][2]][4]
+
+    def read(self, name: str) -> bytes:
+        offset, packed, size, codec, _ = self._blobs[self._entries[name][2]]
+        view = memoryview(self._map)[offset:offset + packed]
+        try:
+            if codec == CODEC_ZLIB:
+                return zlib.decompress(view, bufsize=size or 1)
+            if codec == CODEC_LZMA:
+                return lzma.decompress(view)
+            return bytes(view)
+        finally:
+            view.release()
+
+    def copy(self, name: str, dst: str):
+        """
+        Extracts an entry to dst with its mode and mtime.
+        """
+        mode, mtime, _ = self._entries[name]
+        data = self.read(name)
+        with open(dst, "wb") as f:
+            if data and hasattr(os, "posix_fallocate"):
+                try:
+                    os.posix_fallocate(f.fileno(), 0, len(data))
+                except OSError:
+                    pass
+            f.write(data)
+        os.chmod(dst, mode)
+        os.utime(dst, (mtime, mtime))
+
+
+def GooeyPayload_Open(directory: str):
+    """
+    Opens the payload shipped in directory, or returns None to use loose files.
+    """
+    path = os.path.join(directory, PAYLOAD_NAME)
+    if not os.path.exists(path):
+        return None
+    try:
+        return GooeyPayload(path)
+    except (OSError, ValueError):
+        return None
+
+
+def main(argv):
+    if len(argv) >= 3 and argv[0] == "pack":
+        codec = CODEC_LZMA if "--lzma" in argv else CODEC_ZLIB
+        dirs = [d for d in argv[2:] if not d.startswith("--")]
+        stats = pack(argv[1], ".", [d for d in dirs if os.path.isdir(d)], codec)
+        print(f"{stats['entries']} files, {stats['blobs']} unique blobs, "
+              f"{stats['size']} -> {stats['packed']} bytes")
+        return 0
+    if len(argv) == 2 and argv[0] == "list":
+        payload = GooeyPayload(argv[1])
+        for name in payload.names(""):
+            print(f"{payload.size(name):10d}  {name}")
+        return 0
+    print("usage: installer_payload.py pack OUT DIR... [--lzma] | list PAYLOAD")
+    return 2
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,191 @@
+"""
+ Copyright (c) 2025 Yassine Ahmed Ali
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <https://www.gnu.org/licenses/>.
+"""
+
+import os
+
+from installer_copy import FileSource
+
+# --- Install transactions ---
+#
+# An install is planned before anything is written: the plan knows every
+# destination file, the bytes needed on each mounted filesystem, and the
+# directories that do not exist yet. Preflight checks free space and write
+# permission up front so a problem is reported before the first copy.
+#
+# The transaction then creates the missing directories in one parent-first
+# pass, copies every file to a staged name next to its destination, and only
+# when all copies succeeded renames the staged files into place. Files being
+# replaced or removed are renamed aside first, so rollback can restore them
+# and a failed install never leaves a half-written tree.
+
+STAGE_SUFFIX = ".gooey-new"
+BACKUP_SUFFIX = ".gooey-old"
+_BLOCK = 4096
+
+
+def _existing_ancestor(path: str) -> str:
+    while not os.path.exists(path):
+        parent = os.path.dirname(path)
+        if parent == path:
+            break
+        path = parent
+    return path
+
+def _mount_point(path: str) -> str:
+    path = os.path.abspath(path)
+    dev = os.stat(path).st_dev
+    while path != os.path.dirname(path):
+        parent = os.path.dirname(path)
+        if os.stat(parent).st_dev != dev:
+            break
+        path = parent
+    return path
+
+def _mb(nbytes: int) -> str:
+    return f"{nbytes / (1 << 20):.1f} MB"
+
+
+class InstallPlan:
+    """
+    Dry run of an install: files, sizes and directories, without writing.
+    jobs are (src, dst_file) pairs; removed are installed files to delete.
+    """
+    def __init__(self, jobs, source=None, removed=()):
+        self.source = source or FileSource()
+        self.jobs = list(jobs)
+        self.removed = list(removed)
+        self.sizes = {src: self.source.size(src) for src, _ in self.jobs}
+        self.total_bytes = sum(self.sizes.values())
+        dirs = set()
+        for _, dst in self.jobs:
+            d = os.path.dirname(dst)
+            while d and d not in dirs and not os.path.isdir(d):
+                dirs.add(d)
+                d = os.path.dirname(d)
+        # Sorting puts every parent before its children.
+        self.directories = sorted(dirs)
+        self.required = {}
+        for src, dst in self.jobs:
+            mount = _mount_point(_existing_ancestor(os.path.dirname(dst)))
+            blocks = -(-self.sizes[src] // _BLOCK) * _BLOCK
+            self.required[mount] = self.required.get(mount, 0) + blocks
+
+    def summary(self) -> str:
+        return (f"{len(self.jobs)} files, {_mb(self.total_bytes)}, "
+                f"{len(self.directories)} new directories, {len(self.removed)} to remove")
+
+    def preflight(self):
+        """
+        Returns a list of problems that would make the install fail; empty if none.
+        """
+        problems = []
+        for mount, needed in self.required.items():
+            st = os.statvfs(mount)
+            free = st.f_bavail * st.f_frsize
+            if free < needed:
+                problems.append(f"Not enough space on {mount}: need {_mb(needed)}, {_mb(free)} free")
+        parents = {_existing_ancestor(d) for d in self.directories}
+        parents.update(os.path.dirname(dst) for _, dst in self.jobs if os.path.isdir(os.path.dirname(dst)))
+        parents.update(os.path.dirname(path) for path in self.removed if os.path.exists(path))
+        for parent in sorted(parents):
+            if not os.access(parent, os.W_OK | os.X_OK):
+                problems.append(f"Permission denied: cannot write to {parent}")
+        return problems
+
+
+class InstallTransaction:
+    """
+    Executes an InstallPlan: copy to staged names, then commit or rollback.
+    """
+    def __init__(self, plan: InstallPlan):
+        self.plan = plan
+        self._created = []
+        self._backups = []
+        self._placed = []
+
+    @staticmethod
+    def staged(dst: str) -> str:
+        return dst + STAGE_SUFFIX
+
+    def staged_jobs(self, jobs=None):
+        """
+        Maps (src, dst) jobs to (src, staged dst) for the copy engine.
+        """
+        return [(src, self.staged(dst)) for src, dst in (self.plan.jobs if jobs is None else jobs)]
+
+    def create_directories(self):
+        for d in self.plan.directories:
+            try:
+                os.mkdir(d)
+            except FileExistsError:
+                continue
+            self._created.append(d)
+
+    def _set_aside(self, path):
+        if os.path.lexists(path):
+            os.replace(path, path + BACKUP_SUFFIX)
+            self._backups.append(path)
+
+    def commit(self):
+        """
+        Moves staged files into place and removed files aside; rolls back on failure.
+        """
+        try:
+            for path in self.plan.removed:
+                self._set_aside(path)
+            for _, dst in self.plan.jobs:
+                self._set_aside(dst)
+                os.replace(self.staged(dst), dst)
+                self._placed.append(dst)
+        except BaseException:
+            self.rollback()
+            raise
+        for path in self._backups:
+            try:
+                os.remove(path + BACKUP_SUFFIX)
+            except OSError:
+                pass
+        self._backups = []
+        self._placed = []  # committed; a later rollback must not remove them
+
+    def rollback(self):
+        """
+        Restores the tree to its state before the transaction. Best effort.
+        """
+        for dst in reversed(self._placed):
+            try:
+                os.remove(dst)
+            except OSError:
+                pass
+        self._placed = []
+        for path in reversed(self._backups):
+            try:
+                os.replace(path + BACKUP_SUFFIX, path)
+            except OSError:
+                pass
+        self._backups = []
+        for _, dst in self.plan.jobs:
+            try:
+                os.remove(self.staged(dst))
+            except OSError:
+                pass
+        for d in reversed(self._created):
+            try:
+                os.rmdir(d)
+            except OSError:
+                pass
+        self._created = []